@@ -39,6 +39,7 @@ ThreeGppAntennaArrayModel::ThreeGppAntennaArrayModel (void)
 ThreeGppAntennaArrayModel::~ThreeGppAntennaArrayModel (void)
 {
   NS_LOG_FUNCTION (this);
+  ReleaseFieldPatternTable ();
 }
 
 TypeId
@@ -87,6 +88,13 @@ ThreeGppAntennaArrayModel::GetTypeId (void)
                BooleanValue (false),
                MakeBooleanAccessor (&ThreeGppAntennaArrayModel::m_isIsotropic),
                MakeBooleanChecker ())
+    .AddAttribute ("FieldPatternTableResolution",
+               "If positive, the resolution in degrees of the (azimuth, inclination) grid "
+               "in which the element field pattern in the LCS is precomputed and interpolated. "
+               "If 0, the field pattern is computed for every direction.",
+               DoubleValue (0.0),
+               MakeDoubleAccessor (&ThreeGppAntennaArrayModel::m_tableResolution),
+               MakeDoubleChecker<double> (0, 10))
   ;
   return tid;
 }
@@ -141,9 +149,6 @@ ThreeGppAntennaArrayModel::GetElementFieldPattern (Angles a) const
   double phiPrime = std::arg (std::complex<double> (cos (m_beta)*sin (a.theta)*cos (a.phi-m_alpha) - sin (m_beta)*cos (a.theta), sin (a.phi-m_alpha)*sin (a.theta)));
   NS_LOG_DEBUG (a.theta << " " << thetaPrime << " " << a.phi << " " << phiPrime);
 
-  double aPrimeDb = GetRadiationPattern (thetaPrime, phiPrime);
-  double aPrime = pow (10, aPrimeDb / 10); // convert to linear
-
   // compute psi using eq. 7.1-15 in 3GPP TR 38.901, assuming that the slant 
   // angle (gamma) is 0
   double psi = std::arg (std::complex<double> (cos (m_beta) * sin (a.theta) - sin (m_beta) * cos (a.theta)* cos (a.phi - m_alpha), sin (m_beta)* sin (a.phi-m_alpha)));
@@ -153,7 +158,7 @@ ThreeGppAntennaArrayModel::GetElementFieldPattern (Angles a) const
   // eq. 7.3-4 in 3GPP TR 38.901
   // NOTE we assume vertical polarization, hence the field pattern in the
   // horizontal polarization is 0
-  double fieldThetaPrime = std::sqrt (aPrime);
+  double fieldThetaPrime = GetLcsFieldPattern (thetaPrime, phiPrime);
 
   // convert the antenna element field pattern to GCS using eq. 7.1-11
   // in 3GPP TR 38.901
@@ -164,6 +169,108 @@ ThreeGppAntennaArrayModel::GetElementFieldPattern (Angles a) const
   return std::make_pair (fieldPhi, fieldTheta);
 }
 
+double
+ThreeGppAntennaArrayModel::GetLcsFieldPattern (double thetaPrime, double phiPrime) const
+{
+  if (m_tableResolution <= 0)
+    {
+      double aPrimeDb = GetRadiationPattern (thetaPrime, phiPrime);
+      double aPrime = pow (10, aPrimeDb / 10); // convert to linear
+      return std::sqrt (aPrime);
+    }
+
+  Ptr<const FieldPatternTable> table = GetFieldPatternTable ();
+
+  // bilinear interpolation between the four closest samples
+  double phiPos = (phiPrime + M_PI) / table->m_resolution;
+  double thetaPos = thetaPrime / table->m_resolution;
+  uint32_t phiIndex = std::min (static_cast<uint32_t> (phiPos), table->m_numPhi - 2);
+  uint32_t thetaIndex = std::min (static_cast<uint32_t> (thetaPos), table->m_numTheta - 2);
+  double phiFrac = std::min (phiPos - phiIndex, 1.0);
+  double thetaFrac = std::min (thetaPos - thetaIndex, 1.0);
+
+  const double *row = &table->m_values[thetaIndex * table->m_numPhi + phiIndex];
+  const double *nextRow = row + table->m_numPhi;
+
+  return (1 - thetaFrac) * ((1 - phiFrac) * row[0] + phiFrac * row[1])
+    + thetaFrac * ((1 - phiFrac) * nextRow[0] + phiFrac * nextRow[1]);
+}
+
+std::map<ThreeGppAntennaArrayModel::FieldPatternTableKey_t, Ptr<const ThreeGppAntennaArrayModel::FieldPatternTable> >&
+ThreeGppAntennaArrayModel::GetFieldPatternTables (void)
+{
+  static std::map<FieldPatternTableKey_t, Ptr<const FieldPatternTable> > tables;
+  return tables;
+}
+
+Ptr<const ThreeGppAntennaArrayModel::FieldPatternTable>
+ThreeGppAntennaArrayModel::GetFieldPatternTable (void) const
+{
+  double resolution = m_tableResolution * M_PI / 180;
+  if (m_fieldPatternTable
+      && m_fieldPatternTable->m_gE == m_gE
+      && m_fieldPatternTable->m_isIsotropic == m_isIsotropic
+      && m_fieldPatternTable->m_resolution == resolution)
+    {
+      return m_fieldPatternTable;
+    }
+  ReleaseFieldPatternTable ();
+
+  // tables are shared by all the antennas with the same element pattern
+  std::map<FieldPatternTableKey_t, Ptr<const FieldPatternTable> >& tables = GetFieldPatternTables ();
+  FieldPatternTableKey_t key = std::make_tuple (m_gE, m_isIsotropic, resolution);
+  auto it = tables.find (key);
+  if (it == tables.end ())
+    {
+      NS_LOG_DEBUG ("Build the field pattern table with resolution " << m_tableResolution << " degrees");
+      Ptr<FieldPatternTable> table = Create<FieldPatternTable> ();
+      table->m_gE = m_gE;
+      table->m_isIsotropic = m_isIsotropic;
+      table->m_resolution = resolution;
+      table->m_numPhi = static_cast<uint32_t> (std::ceil (2 * M_PI / resolution)) + 1;
+      table->m_numTheta = static_cast<uint32_t> (std::ceil (M_PI / resolution)) + 1;
+      table->m_values.reserve (table->m_numPhi * table->m_numTheta);
+      for (uint32_t thetaIndex = 0; thetaIndex < table->m_numTheta; thetaIndex++)
+        {
+          double theta = std::min (thetaIndex * resolution, M_PI);
+          for (uint32_t phiIndex = 0; phiIndex < table->m_numPhi; phiIndex++)
+            {
+              double phi = std::min (phiIndex * resolution - M_PI, M_PI);
+              double aPrimeDb = GetRadiationPattern (theta, phi);
+              table->m_values.push_back (std::sqrt (pow (10, aPrimeDb / 10)));
+            }
+        }
+      it = tables.insert (std::make_pair (key, table)).first;
+    }
+  m_fieldPatternTable = it->second;
+  return m_fieldPatternTable;
+}
+
+void
+ThreeGppAntennaArrayModel::ReleaseFieldPatternTable (void) const
+{
+  if (m_fieldPatternTable == 0)
+    {
+      return;
+    }
+  m_fieldPatternTable = 0;
+
+  // drop the tables that are only referenced by the cache
+  std::map<FieldPatternTableKey_t, Ptr<const FieldPatternTable> >& tables = GetFieldPatternTables ();
+  auto it = tables.begin ();
+  while (it != tables.end ())
+    {
+      if (it->second->GetReferenceCount () == 1)
+        {
+          tables.erase (it++);
+        }
+      else
+        {
+          ++it;
+        }
+    }
+}
+
 double
 ThreeGppAntennaArrayModel::GetRadiationPattern (double thetaRadian, double phiRadian) const
 {
@@ -23,6 +23,9 @@
 
 #include <ns3/antenna-model.h>
 #include <complex>
+#include <vector>
+#include <map>
+#include <tuple>
 
 namespace ns3 {
 
@@ -33,6 +36,15 @@ namespace ns3 {
  * 
  * \note the current implementation supports the modeling of antenna arrays 
  * composed of a single panel and with single (vertical) polarization.
+ *
+ * If the FieldPatternTableResolution attribute is set to a positive value,
+ * the element field pattern in the LCS is sampled once over a regular
+ * (azimuth, inclination) grid with that resolution, and
+ * GetElementFieldPattern () bilinearly interpolates in this grid.  The
+ * conversion from GCS to LCS and the polarization are still computed for
+ * every direction, hence grids do not depend on the orientation of the
+ * antenna and are shared by all the antennas with the same element gain
+ * and resolution.
  */
 class ThreeGppAntennaArrayModel : public Object
 {
@@ -109,6 +121,53 @@ public:
   const ComplexVector & GetBeamformingVector (void) const;
 
 private:
+  /**
+   * Data structure that stores the element field pattern in the LCS sampled
+   * over a regular grid of azimuth and inclination angles
+   */
+  struct FieldPatternTable : public SimpleRefCount<FieldPatternTable>
+  {
+    double m_gE; //!< the element gain used to build the table (dBi)
+    bool m_isIsotropic; //!< whether the table was built for isotropic elements
+    double m_resolution; //!< the angular resolution of the table (radians)
+    uint32_t m_numPhi; //!< number of azimuth samples, covering [-pi, pi]
+    uint32_t m_numTheta; //!< number of inclination samples, covering [0, pi]
+    std::vector<double> m_values; //!< field pattern in the LCS at [theta * m_numPhi + phi]
+  };
+
+  /// Key identifying a field pattern table: element gain, isotropic elements, resolution
+  typedef std::tuple<double, bool, double> FieldPatternTableKey_t;
+
+  /**
+   * Returns the field pattern of an antenna element in the LCS, i.e., the
+   * square root of the linear radiation power pattern, either computed or
+   * interpolated in the field pattern table
+   * \param thetaPrime the vertical angle in the LCS in radians
+   * \param phiPrime the horizontal angle in the LCS in radians
+   * \return the field pattern in the LCS
+   */
+  double GetLcsFieldPattern (double thetaPrime, double phiPrime) const;
+
+  /**
+   * Returns the field pattern table matching the current configuration of
+   * the antenna, building it if no antenna with the same configuration
+   * has built it yet
+   * \return the field pattern table
+   */
+  Ptr<const FieldPatternTable> GetFieldPatternTable (void) const;
+
+  /**
+   * Returns the tables shared by all the antennas
+   * \return the shared field pattern tables
+   */
+  static std::map<FieldPatternTableKey_t, Ptr<const FieldPatternTable> >& GetFieldPatternTables (void);
+
+  /**
+   * Stops using the current field pattern table, and frees the tables that
+   * are not used by any antenna anymore
+   */
+  void ReleaseFieldPatternTable (void) const;
+
   /**
    * Returns the radiation power pattern of a single antenna element in dB,
    * generated according to Table 7.3-1 in 3GPP TR 38.901
@@ -128,6 +187,8 @@ private:
   double m_beta; //!< the downtilt angle in radians
   double m_gE; //!< directional gain of a single antenna element (dBi)
   bool m_isIsotropic; //!< if true, antenna elements are isotropic
+  double m_tableResolution; //!< resolution of the field pattern table in degrees, 0 to disable it
+  mutable Ptr<const FieldPatternTable> m_fieldPatternTable; //!< the field pattern table in use, if any
 };
 
 } /* namespace ns3 */
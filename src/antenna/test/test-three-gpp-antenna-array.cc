@@ -0,0 +1,138 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <ns3/log.h>
+#include <ns3/test.h>
+#include <ns3/double.h>
+#include <ns3/boolean.h>
+#include <ns3/three-gpp-antenna-array-model.h>
+#include <cmath>
+#include <string>
+#include <sstream>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("TestThreeGppAntennaArrayModel");
+
+/**
+ * \ingroup antenna-tests
+ *
+ * Checks that the element field pattern interpolated in the precomputed
+ * table matches the one computed for every direction
+ */
+class ThreeGppAntennaArrayFieldPatternTableTestCase : public TestCase
+{
+public:
+  /**
+   * Build the test name
+   * \param bearing the bearing angle in degrees
+   * \param downtilt the downtilt angle in degrees
+   * \param resolution the resolution of the table in degrees
+   * \return the test name
+   */
+  static std::string BuildNameString (double bearing, double downtilt, double resolution);
+  /**
+   * Constructor
+   * \param bearing the bearing angle in degrees
+   * \param downtilt the downtilt angle in degrees
+   * \param resolution the resolution of the table in degrees
+   * \param tolerance the maximum difference between the field pattern components
+   */
+  ThreeGppAntennaArrayFieldPatternTableTestCase (double bearing, double downtilt, double resolution, double tolerance);
+
+private:
+  virtual void DoRun (void);
+
+  double m_bearing; //!< the bearing angle in degrees
+  double m_downtilt; //!< the downtilt angle in degrees
+  double m_resolution; //!< the resolution of the table in degrees
+  double m_tolerance; //!< the maximum difference between the field pattern components
+};
+
+std::string
+ThreeGppAntennaArrayFieldPatternTableTestCase::BuildNameString (double bearing, double downtilt, double resolution)
+{
+  std::ostringstream oss;
+  oss << "bearing=" << bearing << "deg"
+      << ", downtilt=" << downtilt << "deg"
+      << ", resolution=" << resolution << "deg";
+  return oss.str ();
+}
+
+ThreeGppAntennaArrayFieldPatternTableTestCase::ThreeGppAntennaArrayFieldPatternTableTestCase (double bearing, double downtilt, double resolution, double tolerance)
+  : TestCase (BuildNameString (bearing, downtilt, resolution)),
+    m_bearing (bearing),
+    m_downtilt (downtilt),
+    m_resolution (resolution),
+    m_tolerance (tolerance)
+{
+}
+
+void
+ThreeGppAntennaArrayFieldPatternTableTestCase::DoRun ()
+{
+  Ptr<ThreeGppAntennaArrayModel> exact = CreateObject<ThreeGppAntennaArrayModel> ();
+  exact->SetAttribute ("BearingAngle", DoubleValue (m_bearing * M_PI / 180));
+  exact->SetAttribute ("DowntiltAngle", DoubleValue (m_downtilt * M_PI / 180));
+
+  Ptr<ThreeGppAntennaArrayModel> table = CreateObject<ThreeGppAntennaArrayModel> ();
+  table->SetAttribute ("BearingAngle", DoubleValue (m_bearing * M_PI / 180));
+  table->SetAttribute ("DowntiltAngle", DoubleValue (m_downtilt * M_PI / 180));
+  table->SetAttribute ("FieldPatternTableResolution", DoubleValue (m_resolution));
+
+  // include angles outside [-pi, pi] to check the azimuth normalization
+  for (double phi = -200; phi <= 200; phi += 1.37)
+    {
+      for (double theta = 0; theta <= 180; theta += 0.93)
+        {
+          Angles a (phi * M_PI / 180, theta * M_PI / 180);
+          std::pair<double, double> expected = exact->GetElementFieldPattern (a);
+          std::pair<double, double> actual = table->GetElementFieldPattern (a);
+          NS_TEST_ASSERT_MSG_EQ_TOL (actual.first, expected.first, m_tolerance,
+                                     "wrong horizontal field component at phi=" << phi << " theta=" << theta);
+          NS_TEST_ASSERT_MSG_EQ_TOL (actual.second, expected.second, m_tolerance,
+                                     "wrong vertical field component at phi=" << phi << " theta=" << theta);
+        }
+    }
+
+  // the orientation is not part of the table, changing it must be accounted for
+  exact->SetAttribute ("BearingAngle", DoubleValue (0));
+  table->SetAttribute ("BearingAngle", DoubleValue (0));
+  Angles a (m_bearing * M_PI / 180, M_PI / 2);
+  NS_TEST_ASSERT_MSG_EQ_TOL (table->GetElementFieldPattern (a).second, exact->GetElementFieldPattern (a).second, m_tolerance,
+                             "the new orientation was not applied");
+}
+
+/**
+ * \ingroup antenna-tests
+ *
+ * \brief ThreeGppAntennaArrayModel Test Suite
+ */
+class ThreeGppAntennaArrayModelTestSuite : public TestSuite
+{
+public:
+  ThreeGppAntennaArrayModelTestSuite ();
+};
+
+ThreeGppAntennaArrayModelTestSuite::ThreeGppAntennaArrayModelTestSuite ()
+  : TestSuite ("three-gpp-antenna-array-model", UNIT)
+{
+  AddTestCase (new ThreeGppAntennaArrayFieldPatternTableTestCase (0, 0, 0.1, 0.01), TestCase::QUICK);
+  AddTestCase (new ThreeGppAntennaArrayFieldPatternTableTestCase (30, 10, 0.1, 0.01), TestCase::QUICK);
+  AddTestCase (new ThreeGppAntennaArrayFieldPatternTableTestCase (-120, 45, 0.5, 0.05), TestCase::QUICK);
+}
+
+static ThreeGppAntennaArrayModelTestSuite g_threeGppAntennaArrayModelTestSuite;
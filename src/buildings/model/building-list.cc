@@ -19,6 +19,8 @@
  * Based on BuildingList implementation by Mathieu Lacage  <mathieu.lacage@sophia.inria.fr>
  *
  */
+#include <algorithm>
+#include <cmath>
 #include "building-list.h"
 #include "ns3/simulator.h"
 #include "ns3/object-vector.h"
@@ -47,6 +49,9 @@ public:
   BuildingList::Iterator End (void) const;
   Ptr<Building> GetBuilding (uint32_t n);
   uint32_t GetNBuildings (void);
+  void GetCandidateBuildings (const Vector &l1, const Vector &l2,
+                              std::vector<Ptr<Building> > &buildings);
+  void NotifyBoundariesChanged (void);
 
   static Ptr<BuildingListPriv> Get (void);
 
@@ -54,9 +59,38 @@ private:
   virtual void DoDispose (void);
   static Ptr<BuildingListPriv> *DoGet (void);
   static void Delete (void);
+  /// Rebuild the grid from the current boundaries of all the buildings
+  void BuildGrid (void);
+  /**
+   * \param x the x coordinate
+   * \return the index of the grid column containing x, clamped to the grid
+   */
+  uint32_t GetColumn (double x) const;
+  /**
+   * \param y the y coordinate
+   * \return the index of the grid row containing y, clamped to the grid
+   */
+  uint32_t GetRow (double y) const;
+
   std::vector<Ptr<Building> > m_buildings;
+
+  bool m_gridValid;                              //!< whether the grid reflects the current buildings
+  double m_gridXMin;                             //!< lower x coordinate of the grid
+  double m_gridXMax;                             //!< upper x coordinate of the grid
+  double m_gridYMin;                             //!< lower y coordinate of the grid
+  double m_gridYMax;                             //!< upper y coordinate of the grid
+  double m_cellSize;                             //!< side of a grid cell
+  double m_epsilon;                              //!< tolerance used when mapping boundaries to cells
+  uint32_t m_nColumns;                           //!< number of grid columns
+  uint32_t m_nRows;                              //!< number of grid rows
+  std::vector<std::vector<uint32_t> > m_cells;   //!< indices of the buildings overlapping each cell
+  std::vector<uint32_t> m_lastVisit;             //!< per-building stamp used to skip duplicates
+  uint32_t m_visit;                              //!< current stamp
 };
 
+/// Maximum number of cells of the building grid
+static const uint32_t BUILDING_GRID_MAX_CELLS = 1 << 20;
+
 NS_OBJECT_ENSURE_REGISTERED (BuildingListPriv);
 
 TypeId
@@ -100,6 +134,16 @@ BuildingListPriv::Delete (void)
 
 
 BuildingListPriv::BuildingListPriv ()
+  : m_gridValid (false),
+    m_gridXMin (0),
+    m_gridXMax (0),
+    m_gridYMin (0),
+    m_gridYMax (0),
+    m_cellSize (1),
+    m_epsilon (0),
+    m_nColumns (0),
+    m_nRows (0),
+    m_visit (0)
 {
   NS_LOG_FUNCTION_NOARGS ();
 }
@@ -118,6 +162,9 @@ BuildingListPriv::DoDispose (void)
       *i = 0;
     }
   m_buildings.erase (m_buildings.begin (), m_buildings.end ());
+  m_cells.clear ();
+  m_lastVisit.clear ();
+  m_gridValid = false;
   Object::DoDispose ();
 }
 
@@ -127,6 +174,7 @@ BuildingListPriv::Add (Ptr<Building> building)
 {
   uint32_t index = m_buildings.size ();
   m_buildings.push_back (building);
+  m_gridValid = false;
   Simulator::ScheduleWithContext (index, TimeStep (0), &Building::Initialize, building);
   return index;
 
@@ -155,6 +203,159 @@ BuildingListPriv::GetBuilding (uint32_t n)
   return m_buildings.at (n);
 }
 
+void
+BuildingListPriv::NotifyBoundariesChanged (void)
+{
+  m_gridValid = false;
+}
+
+uint32_t
+BuildingListPriv::GetColumn (double x) const
+{
+  double column = std::floor ((x - m_gridXMin) / m_cellSize);
+  column = std::max (column, 0.0);
+  column = std::min (column, m_nColumns - 1.0);
+  return static_cast<uint32_t> (column);
+}
+
+uint32_t
+BuildingListPriv::GetRow (double y) const
+{
+  double row = std::floor ((y - m_gridYMin) / m_cellSize);
+  row = std::max (row, 0.0);
+  row = std::min (row, m_nRows - 1.0);
+  return static_cast<uint32_t> (row);
+}
+
+void
+BuildingListPriv::BuildGrid (void)
+{
+  NS_LOG_FUNCTION (this << m_buildings.size ());
+  m_cells.clear ();
+  m_lastVisit.assign (m_buildings.size (), 0);
+  m_visit = 0;
+  m_nColumns = 0;
+  m_nRows = 0;
+  m_gridValid = true;
+  if (m_buildings.empty ())
+    {
+      return;
+    }
+
+  // the cell side is the largest of the mean building side and of the side
+  // giving about one cell per building over the area spanned by all buildings
+  Box first = m_buildings.front ()->GetBoundaries ();
+  m_gridXMin = first.xMin;
+  m_gridXMax = first.xMax;
+  m_gridYMin = first.yMin;
+  m_gridYMax = first.yMax;
+  double sumSide = 0;
+  for (std::vector<Ptr<Building> >::const_iterator it = m_buildings.begin (); it != m_buildings.end (); ++it)
+    {
+      Box box = (*it)->GetBoundaries ();
+      m_gridXMin = std::min (m_gridXMin, box.xMin);
+      m_gridXMax = std::max (m_gridXMax, box.xMax);
+      m_gridYMin = std::min (m_gridYMin, box.yMin);
+      m_gridYMax = std::max (m_gridYMax, box.yMax);
+      sumSide += std::max (box.xMax - box.xMin, box.yMax - box.yMin);
+    }
+  double width = m_gridXMax - m_gridXMin;
+  double height = m_gridYMax - m_gridYMin;
+  m_cellSize = std::max (sumSide / m_buildings.size (), std::sqrt (width * height / m_buildings.size ()));
+  if (!(m_cellSize > 0))
+    {
+      m_cellSize = 1;
+    }
+  while ((std::floor (width / m_cellSize) + 1) * (std::floor (height / m_cellSize) + 1) > BUILDING_GRID_MAX_CELLS)
+    {
+      m_cellSize *= 2;
+    }
+  m_nColumns = static_cast<uint32_t> (std::floor (width / m_cellSize)) + 1;
+  m_nRows = static_cast<uint32_t> (std::floor (height / m_cellSize)) + 1;
+  m_epsilon = 1e-6 * m_cellSize;
+  m_cells.resize (m_nColumns * m_nRows);
+
+  for (uint32_t index = 0; index < m_buildings.size (); index++)
+    {
+      Box box = m_buildings[index]->GetBoundaries ();
+      uint32_t columnMax = GetColumn (box.xMax + m_epsilon);
+      uint32_t rowMax = GetRow (box.yMax + m_epsilon);
+      for (uint32_t row = GetRow (box.yMin - m_epsilon); row <= rowMax; row++)
+        {
+          for (uint32_t column = GetColumn (box.xMin - m_epsilon); column <= columnMax; column++)
+            {
+              m_cells[row * m_nColumns + column].push_back (index);
+            }
+        }
+    }
+  NS_LOG_DEBUG ("Building grid of " << m_nColumns << "x" << m_nRows << " cells of side " << m_cellSize);
+}
+
+void
+BuildingListPriv::GetCandidateBuildings (const Vector &l1, const Vector &l2,
+                                         std::vector<Ptr<Building> > &buildings)
+{
+  NS_LOG_FUNCTION (this << l1 << l2);
+  buildings.clear ();
+  if (!m_gridValid)
+    {
+      BuildGrid ();
+    }
+  double xLow = std::min (l1.x, l2.x);
+  double xHigh = std::max (l1.x, l2.x);
+  double yLow = std::min (l1.y, l2.y);
+  double yHigh = std::max (l1.y, l2.y);
+  if (m_cells.empty ()
+      || xHigh < m_gridXMin - m_epsilon || xLow > m_gridXMax + m_epsilon
+      || yHigh < m_gridYMin - m_epsilon || yLow > m_gridYMax + m_epsilon)
+    {
+      return;
+    }
+  if (++m_visit == 0)
+    {
+      std::fill (m_lastVisit.begin (), m_lastVisit.end (), 0);
+      m_visit = 1;
+    }
+
+  std::vector<uint32_t> indices;
+  uint32_t rowMax = GetRow (yHigh + m_epsilon);
+  for (uint32_t row = GetRow (yLow - m_epsilon); row <= rowMax; row++)
+    {
+      // x range of the segment within this row
+      double rowLow = std::max (yLow, m_gridYMin + row * m_cellSize);
+      double rowHigh = std::min (yHigh, m_gridYMin + (row + 1) * m_cellSize);
+      double xa = xLow;
+      double xb = xHigh;
+      if (l1.y != l2.y && rowLow <= rowHigh)
+        {
+          double slope = (l2.x - l1.x) / (l2.y - l1.y);
+          double x1 = l1.x + (rowLow - l1.y) * slope;
+          double x2 = l1.x + (rowHigh - l1.y) * slope;
+          xa = std::max (xLow, std::min (x1, x2));
+          xb = std::min (xHigh, std::max (x1, x2));
+        }
+      uint32_t columnMax = GetColumn (xb + m_epsilon);
+      for (uint32_t column = GetColumn (xa - m_epsilon); column <= columnMax; column++)
+        {
+          const std::vector<uint32_t> &cell = m_cells[row * m_nColumns + column];
+          for (std::vector<uint32_t>::const_iterator it = cell.begin (); it != cell.end (); ++it)
+            {
+              if (m_lastVisit[*it] != m_visit)
+                {
+                  m_lastVisit[*it] = m_visit;
+                  indices.push_back (*it);
+                }
+            }
+        }
+    }
+  std::sort (indices.begin (), indices.end ());
+  buildings.reserve (indices.size ());
+  for (std::vector<uint32_t>::const_iterator it = indices.begin (); it != indices.end (); ++it)
+    {
+      buildings.push_back (m_buildings[*it]);
+    }
+}
+
 }
 
 /**
@@ -189,5 +390,16 @@ BuildingList::GetNBuildings (void)
 {
   return BuildingListPriv::Get ()->GetNBuildings ();
 }
+void
+BuildingList::GetCandidateBuildings (const Vector &l1, const Vector &l2,
+                                     std::vector<Ptr<Building> > &buildings)
+{
+  BuildingListPriv::Get ()->GetCandidateBuildings (l1, l2, buildings);
+}
+void
+BuildingList::NotifyBoundariesChanged (void)
+{
+  BuildingListPriv::Get ()->NotifyBoundariesChanged ();
+}
 
 } // namespace ns3
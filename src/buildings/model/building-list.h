@@ -25,6 +25,7 @@
 
 #include <vector>
 #include "ns3/ptr.h"
+#include "ns3/vector.h"
 
 namespace ns3 {
 
@@ -62,6 +63,28 @@ public:
    * \returns the number of buildings currently in the list.
    */
   static uint32_t GetNBuildings (void);
+  /**
+   * \param l1 the first endpoint of the segment
+   * \param l2 the second endpoint of the segment
+   * \param buildings filled with the buildings whose horizontal footprint
+   *        may intersect the segment [l1, l2], in increasing order of id.
+   *
+   * The candidates are found through a uniform 2D grid over all the
+   * buildings, which is rebuilt lazily whenever a building is added or
+   * moved.  The returned set is conservative: callers still have to use
+   * Building::IsIntersect or Building::IsInside to obtain exact results.
+   * To look up the buildings that may contain a position, pass that
+   * position as both l1 and l2.
+   */
+  static void GetCandidateBuildings (const Vector &l1, const Vector &l2,
+                                     std::vector<Ptr<Building> > &buildings);
+  /**
+   * Invalidate the grid used by GetCandidateBuildings.
+   *
+   * This method is called automatically from Building::SetBoundaries, so
+   * it rarely needs to be called directly.
+   */
+  static void NotifyBoundariesChanged (void);
 };
 
 } // namespace ns3
@@ -179,7 +179,9 @@ MobilityBuildingInfo::MakeConsistent (Ptr<MobilityModel> mm)
 {
   bool found = false;
   Vector pos = mm->GetPosition ();
-  for (BuildingList::Iterator bit = BuildingList::Begin (); bit != BuildingList::End (); ++bit)
+  std::vector<Ptr<Building> > buildings;
+  BuildingList::GetCandidateBuildings (pos, pos, buildings);
+  for (std::vector<Ptr<Building> >::const_iterator bit = buildings.begin (); bit != buildings.end (); ++bit)
     {
       NS_LOG_LOGIC ("checking building " << (*bit)->GetId () << " with boundaries " << (*bit)->GetBoundaries ());
       if ((*bit)->IsInside (pos))
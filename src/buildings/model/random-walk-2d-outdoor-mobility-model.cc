@@ -203,7 +203,9 @@ RandomWalk2dOutdoorMobilityModel::IsLineClearOfBuildings ( Vector currentPositio
   double minIntersectionDistance = std::numeric_limits<double>::max ();
   Ptr<Building> minIntersectionDistanceBuilding;
 
-  for (BuildingList::Iterator bit = BuildingList::Begin (); bit != BuildingList::End (); ++bit)
+  std::vector<Ptr<Building> > buildings;
+  BuildingList::GetCandidateBuildings (currentPosition, nextPosition, buildings);
+  for (std::vector<Ptr<Building> >::const_iterator bit = buildings.begin (); bit != buildings.end (); ++bit)
     {
       // check if this building intersects the line between the current and next positions
       // this checks also if the next position is inside the building
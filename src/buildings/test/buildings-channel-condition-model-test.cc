@@ -25,6 +25,8 @@
 #include "ns3/buildings-module.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
+#include "ns3/random-variable-stream.h"
+#include <algorithm>
 
 using namespace ns3;
 
@@ -139,6 +141,97 @@ BuildingsChannelConditionModelTestCase::DoRun (void)
   Simulator::Destroy ();
 }
 
+/**
+ * Test case for BuildingList::GetCandidateBuildings. It checks, for many
+ * random segments and positions, that the grid returns every building
+ * that a linear scan of the BuildingList finds intersecting the segment
+ */
+class BuildingListGridTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor
+   */
+  BuildingListGridTestCase ();
+
+  /**
+   * Destructor
+   */
+  virtual ~BuildingListGridTestCase ();
+
+private:
+  /**
+   * Builds the simulation scenario and perform the tests
+   */
+  virtual void DoRun (void);
+};
+
+BuildingListGridTestCase::BuildingListGridTestCase ()
+  : TestCase ("Test case for the grid of the BuildingList")
+{
+}
+
+BuildingListGridTestCase::~BuildingListGridTestCase ()
+{
+}
+
+void
+BuildingListGridTestCase::DoRun (void)
+{
+  Ptr<UniformRandomVariable> uniform = CreateObject<UniformRandomVariable> ();
+  uniform->SetStream (1);
+
+  // buildings of various sizes, some of them sharing walls
+  for (uint32_t i = 0; i < 200; ++i)
+    {
+      double x = uniform->GetValue (0.0, 1000.0);
+      double y = uniform->GetValue (0.0, 500.0);
+      double width = (i % 10 == 0) ? 150.0 : uniform->GetValue (5.0, 40.0);
+      Ptr<Building> building = CreateObject<Building> ();
+      building->SetBoundaries (Box (x, x + width, y, y + 20.0, 0.0, 10.0));
+      if (i % 4 == 0)
+        {
+          Ptr<Building> neighbor = CreateObject<Building> ();
+          neighbor->SetBoundaries (Box (x + width, x + 2 * width, y, y + 20.0, 0.0, 10.0));
+        }
+    }
+
+  std::vector<Ptr<Building> > candidates;
+  for (uint32_t i = 0; i < 2000; ++i)
+    {
+      Vector l1 (uniform->GetValue (-100.0, 1300.0), uniform->GetValue (-100.0, 600.0), 1.5);
+      Vector l2 = l1;
+      if (i % 3 == 1)
+        {
+          l2.x = uniform->GetValue (-100.0, 1300.0);
+        }
+      else if (i % 3 == 2)
+        {
+          l2 = Vector (uniform->GetValue (-100.0, 1300.0), uniform->GetValue (-100.0, 600.0), 1.5);
+        }
+      BuildingList::GetCandidateBuildings (l1, l2, candidates);
+      for (BuildingList::Iterator bit = BuildingList::Begin (); bit != BuildingList::End (); ++bit)
+        {
+          if ((*bit)->IsIntersect (l1, l2))
+            {
+              bool found = std::find (candidates.begin (), candidates.end (), *bit) != candidates.end ();
+              NS_TEST_ASSERT_MSG_EQ (found, true, "Building " << (*bit)->GetId () << " intersecting "
+                                     << l1 << " - " << l2 << " not returned by the grid");
+            }
+        }
+    }
+
+  // moving a building must be reflected by the grid
+  Ptr<Building> moved = BuildingList::GetBuilding (0);
+  moved->SetBoundaries (Box (2000.0, 2010.0, 2000.0, 2010.0, 0.0, 10.0));
+  Vector inside (2005.0, 2005.0, 1.5);
+  BuildingList::GetCandidateBuildings (inside, inside, candidates);
+  NS_TEST_ASSERT_MSG_EQ (candidates.size (), 1, "Moved building not found by the grid");
+  NS_TEST_ASSERT_MSG_EQ (candidates.front (), moved, "Moved building not found by the grid");
+
+  Simulator::Destroy ();
+}
+
 /**
  * Test suite for the buildings channel condition model
  */
@@ -152,6 +245,7 @@ BuildingsChannelConditionModelsTestSuite::BuildingsChannelConditionModelsTestSui
   : TestSuite ("buildings-channel-condition-model", UNIT)
 {
   AddTestCase (new BuildingsChannelConditionModelTestCase, TestCase::QUICK);
+  AddTestCase (new BuildingListGridTestCase, TestCase::QUICK);
 }
 
 static BuildingsChannelConditionModelsTestSuite BuildingsChannelConditionModelsTestSuite;
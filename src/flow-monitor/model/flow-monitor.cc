@@ -22,6 +22,8 @@
 #include "ns3/simulator.h"
 #include "ns3/log.h"
 #include "ns3/double.h"
+#include "ns3/uinteger.h"
+#include "ns3/hash.h"
 #include <fstream>
 #include <sstream>
 
@@ -69,6 +71,12 @@ FlowMonitor::GetTypeId (void)
                    TimeValue (Seconds (0.5)),
                    MakeTimeAccessor (&FlowMonitor::m_flowInterruptionsMinTime),
                    MakeTimeChecker ())
+    .AddAttribute ("FlowSampling", ("Monitor only one flow in every N flows. Flows are selected "
+                                    "by hashing their identifier, hence the same flows are "
+                                    "monitored by all the probes. 1 means that all the flows are monitored."),
+                   UintegerValue (1),
+                   MakeUintegerAccessor (&FlowMonitor::m_flowSampling),
+                   MakeUintegerChecker<uint32_t> (1))
   ;
   return tid;
 }
@@ -105,6 +113,18 @@ FlowMonitor::DoDispose (void)
   Object::DoDispose ();
 }
 
+bool
+FlowMonitor::IsFlowSampled (FlowId flowId) const
+{
+  if (m_flowSampling <= 1)
+    {
+      return true;
+    }
+  // flow identifiers are assigned sequentially, hash them so that the
+  // sampled flows do not follow the order in which flows start
+  return Hash32 ((char*) &flowId, sizeof (flowId)) % m_flowSampling == 0;
+}
+
 inline FlowMonitor::FlowStats&
 FlowMonitor::GetStatsForFlow (FlowId flowId)
 {
@@ -145,6 +165,10 @@ FlowMonitor::ReportFirstTx (Ptr<FlowProbe> probe, uint32_t flowId, uint32_t pack
       NS_LOG_DEBUG ("FlowMonitor not enabled; returning");
       return;
     }
+  if (!IsFlowSampled (flowId))
+    {
+      return;
+    }
   Time now = Simulator::Now ();
   TrackedPacket &tracked = m_trackedPackets[std::make_pair (flowId, packetId)];
   tracked.firstSeenTime = now;
@@ -175,6 +199,10 @@ FlowMonitor::ReportForwarding (Ptr<FlowProbe> probe, uint32_t flowId, uint32_t p
       NS_LOG_DEBUG ("FlowMonitor not enabled; returning");
       return;
     }
+  if (!IsFlowSampled (flowId))
+    {
+      return;
+    }
   std::pair<FlowId, FlowPacketId> key (flowId, packetId);
   TrackedPacketMap::iterator tracked = m_trackedPackets.find (key);
   if (tracked == m_trackedPackets.end ())
@@ -201,6 +229,10 @@ FlowMonitor::ReportLastRx (Ptr<FlowProbe> probe, uint32_t flowId, uint32_t packe
       NS_LOG_DEBUG ("FlowMonitor not enabled; returning");
       return;
     }
+  if (!IsFlowSampled (flowId))
+    {
+      return;
+    }
   TrackedPacketMap::iterator tracked = m_trackedPackets.find (std::make_pair (flowId, packetId));
   if (tracked == m_trackedPackets.end ())
     {
@@ -267,6 +299,10 @@ FlowMonitor::ReportDrop (Ptr<FlowProbe> probe, uint32_t flowId, uint32_t packetI
       NS_LOG_DEBUG ("FlowMonitor not enabled; returning");
       return;
     }
+  if (!IsFlowSampled (flowId))
+    {
+      return;
+    }
 
   probe->AddPacketDropStats (flowId, packetSize, reasonCode);
 
@@ -23,6 +23,7 @@
 
 #include <vector>
 #include <map>
+#include <unordered_map>
 
 #include "ns3/ptr.h"
 #include "ns3/object.h"
@@ -277,8 +278,22 @@ private:
   /// FlowId --> FlowStats
   FlowStatsContainer m_flowStats;
 
+  /// Hash function for the (FlowId,PacketId) pairs identifying tracked packets
+  struct TrackedPacketKeyHash
+  {
+    /**
+     * \brief Compute the hash of a (FlowId,PacketId) pair
+     * \param key the (FlowId,PacketId) pair
+     * \return the hash value
+     */
+    std::size_t operator() (const std::pair<FlowId, FlowPacketId> &key) const
+    {
+      return std::hash<uint64_t> () ((uint64_t (key.first) << 32) | key.second);
+    }
+  };
+
   /// (FlowId,PacketId) --> TrackedPacket
-  typedef std::map< std::pair<FlowId, FlowPacketId>, TrackedPacket> TrackedPacketMap;
+  typedef std::unordered_map<std::pair<FlowId, FlowPacketId>, TrackedPacket, TrackedPacketKeyHash> TrackedPacketMap;
   TrackedPacketMap m_trackedPackets; //!< Tracked packets
   Time m_maxPerHopDelay; //!< Minimum per-hop delay
   FlowProbeContainer m_flowProbes; //!< all the FlowProbes
@@ -294,6 +309,12 @@ private:
   double m_packetSizeBinWidth;  //!< packet size bin width (for histograms)
   double m_flowInterruptionsBinWidth; //!< Flow interruptions bin width (for histograms)
   Time m_flowInterruptionsMinTime; //!< Flow interruptions minimum time
+  uint32_t m_flowSampling;  //!< Monitor one flow in every m_flowSampling flows
+
+  /// Check whether a flow is monitored when flow sampling is enabled
+  /// \param flowId the Flow identification
+  /// \returns true if the flow is monitored
+  bool IsFlowSampled (FlowId flowId) const;
 
   /// Get the stats for a given flow
   /// \param flowId the Flow identification
@@ -155,29 +155,24 @@ Ipv6FlowClassifier::Classify (const Ipv6Header &ipHeader, Ptr<const Packet> ipPa
   // if the insertion succeeded, we need to assign this tuple a new flow identifier
   if (insert.second)
     {
-      FlowId newFlowId = GetNewFlowId ();
-      insert.first->second = newFlowId;
-      m_flowPktIdMap[newFlowId] = 0;
-      m_flowDscpMap[newFlowId];
+      insert.first->second = GetNewFlowId ();
     }
-  else
+  FlowId flowId = insert.first->second;
+
+  // the first packet of a flow gets the packet identifier 0
+  std::pair<std::map<FlowId, FlowPacketId>::iterator, bool> pktIdInserter
+    = m_flowPktIdMap.insert (std::pair<FlowId, FlowPacketId> (flowId, 0));
+  if (!pktIdInserter.second)
     {
-      m_flowPktIdMap[insert.first->second] ++;
+      pktIdInserter.first->second++;
     }
 
   // increment the counter of packets with the same DSCP value
   Ipv6Header::DscpType dscp = ipHeader.GetDscp ();
-  std::pair<std::map<Ipv6Header::DscpType, uint32_t>::iterator, bool> dscpInserter
-    = m_flowDscpMap[insert.first->second].insert (std::pair<Ipv6Header::DscpType, uint32_t> (dscp, 1));
-
-  // if the insertion did not succeed, we need to increment the counter
-  if (!dscpInserter.second)
-    {
-      m_flowDscpMap[insert.first->second][dscp] ++;
-    }
+  m_flowDscpMap[flowId][dscp]++;
 
-  *out_flowId = insert.first->second;
-  *out_packetId = m_flowPktIdMap[*out_flowId];
+  *out_flowId = flowId;
+  *out_packetId = pktIdInserter.first->second;
 
   return true;
 }
@@ -197,10 +197,13 @@ ArpCache::HandleWaitReplyTimeout (void)
   NS_LOG_FUNCTION (this);
   ArpCache::Entry* entry;
   bool restartWaitReplyTimer = false;
-  for (CacheI i = m_arpCache.begin (); i != m_arpCache.end (); i++) 
+  // Only the entries waiting for a reply need to be visited. Work on a
+  // copy, as marking an entry dead removes it from m_waitReplyEntries.
+  std::list<ArpCache::Entry *> waitReplyEntries = m_waitReplyEntries;
+  for (std::list<ArpCache::Entry *>::iterator i = waitReplyEntries.begin (); i != waitReplyEntries.end (); i++)
     {
-      entry = (*i).second;
-      if (entry != 0 && entry->IsWaitReply ())
+      entry = *i;
+      if (entry->IsWaitReply ())
         {
           if (entry->GetRetries () < m_maxRetries)
             {
@@ -249,6 +252,7 @@ ArpCache::Flush (void)
       delete (*i).second;
     }
   m_arpCache.erase (m_arpCache.begin (), m_arpCache.end ());
+  m_waitReplyEntries.clear ();
   if (m_waitReplyTimer.IsRunning ())
     {
       NS_LOG_LOGIC ("Stopping WaitReplyTimer at " << Simulator::Now ().GetSeconds () << " due to ArpCache flush");
@@ -343,15 +347,17 @@ ArpCache::Remove (ArpCache::Entry *entry)
 {
   NS_LOG_FUNCTION (this << entry);
   
-  for (CacheI i = m_arpCache.begin (); i != m_arpCache.end (); i++)
+  CacheI i = m_arpCache.find (entry->GetIpv4Address ());
+  if (i != m_arpCache.end () && (*i).second == entry)
     {
-      if ((*i).second == entry)
+      m_arpCache.erase (i);
+      if (entry->IsWaitReply ())
         {
-          m_arpCache.erase (i);
-          entry->ClearPendingPacket (); //clear the pending packets for entry's ipaddress
-          delete entry;
-          return;
+          m_waitReplyEntries.remove (entry);
         }
+      entry->ClearPendingPacket (); //clear the pending packets for entry's ipaddress
+      delete entry;
+      return;
     }
   NS_LOG_WARN ("Entry not found in this ARP Cache");
 }
@@ -396,6 +402,10 @@ ArpCache::Entry::MarkDead (void)
 {
   NS_LOG_FUNCTION (this);
   NS_ASSERT (m_state == ALIVE || m_state == WAIT_REPLY || m_state == DEAD);
+  if (m_state == WAIT_REPLY)
+    {
+      m_arp->m_waitReplyEntries.remove (this);
+    }
   m_state = DEAD;
   ClearRetries ();
   UpdateSeen ();
@@ -405,6 +415,7 @@ ArpCache::Entry::MarkAlive (Address macAddress)
 {
   NS_LOG_FUNCTION (this << macAddress);
   NS_ASSERT (m_state == WAIT_REPLY);
+  m_arp->m_waitReplyEntries.remove (this);
   m_macAddress = macAddress;
   m_state = ALIVE;
   ClearRetries ();
@@ -416,6 +427,10 @@ ArpCache::Entry::MarkPermanent (void)
   NS_LOG_FUNCTION (this << m_macAddress);
   NS_ASSERT (!m_macAddress.IsInvalid ());
 
+  if (m_state == WAIT_REPLY)
+    {
+      m_arp->m_waitReplyEntries.remove (this);
+    }
   m_state = PERMANENT;
   ClearRetries ();
   UpdateSeen ();
@@ -445,6 +460,7 @@ ArpCache::Entry::MarkWaitReply (Ipv4PayloadHeaderPair waiting)
   NS_ASSERT_MSG (waiting.first, "Can not add a null packet to the ARP queue");
 
   m_state = WAIT_REPLY;
+  m_arp->m_waitReplyEntries.push_back (this);
   m_pending.push_back (waiting);
   UpdateSeen ();
   m_arp->StartWaitReplyTimer ();
@@ -338,6 +338,7 @@ private:
   void HandleWaitReplyTimeout (void);
   uint32_t m_pendingQueueSize; //!< number of packets waiting for a resolution
   Cache m_arpCache; //!< the ARP cache
+  std::list<ArpCache::Entry *> m_waitReplyEntries; //!< entries in WAIT_REPLY state, in the order they started waiting
   TracedCallback<Ptr<const Packet> > m_dropTrace; //!< trace for packets dropped by the ARP cache queue
 };
 
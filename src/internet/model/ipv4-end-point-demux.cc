@@ -87,6 +87,7 @@ Ipv4EndPointDemux::Allocate (void)
     }
   Ipv4EndPoint *endPoint = new Ipv4EndPoint (Ipv4Address::GetAny (), port);
   m_endPoints.push_back (endPoint);
+  m_exactMatchCache.clear ();
   NS_LOG_DEBUG ("Now have >>" << m_endPoints.size () << "<< endpoints.");
   return endPoint;
 }
@@ -103,6 +104,7 @@ Ipv4EndPointDemux::Allocate (Ipv4Address address)
     }
   Ipv4EndPoint *endPoint = new Ipv4EndPoint (address, port);
   m_endPoints.push_back (endPoint);
+  m_exactMatchCache.clear ();
   NS_LOG_DEBUG ("Now have >>" << m_endPoints.size () << "<< endpoints.");
   return endPoint;
 }
@@ -126,6 +128,7 @@ Ipv4EndPointDemux::Allocate (Ptr<NetDevice> boundNetDevice, Ipv4Address address,
     }
   Ipv4EndPoint *endPoint = new Ipv4EndPoint (address, port);
   m_endPoints.push_back (endPoint);
+  m_exactMatchCache.clear ();
   NS_LOG_DEBUG ("Now have >>" << m_endPoints.size () << "<< endpoints.");
   return endPoint;
 }
@@ -151,6 +154,7 @@ Ipv4EndPointDemux::Allocate (Ptr<NetDevice> boundNetDevice,
   Ipv4EndPoint *endPoint = new Ipv4EndPoint (localAddress, localPort);
   endPoint->SetPeer (peerAddress, peerPort);
   m_endPoints.push_back (endPoint);
+  m_exactMatchCache.clear ();
 
   NS_LOG_DEBUG ("Now have >>" << m_endPoints.size () << "<< endpoints.");
 
@@ -167,6 +171,7 @@ Ipv4EndPointDemux::DeAllocate (Ipv4EndPoint *endPoint)
         {
           delete endPoint;
           m_endPoints.erase (i);
+          m_exactMatchCache.clear ();
           break;
         }
     }
@@ -201,7 +206,26 @@ Ipv4EndPointDemux::Lookup (Ipv4Address daddr, uint16_t dport,
                            Ptr<Ipv4Interface> incomingInterface)
 {
   NS_LOG_FUNCTION (this << daddr << dport << saddr << sport << incomingInterface);
-  
+
+  // Fast path: an end point previously found as the only exact match for
+  // this four-tuple is still the most exact match if it is unchanged
+  FourTuple_t fourTuple = std::make_pair ((static_cast<uint64_t> (daddr.Get ()) << 32) | saddr.Get (),
+                                          (static_cast<uint32_t> (dport) << 16) | sport);
+  std::map<FourTuple_t, Ipv4EndPoint *>::iterator cacheIt = m_exactMatchCache.find (fourTuple);
+  if (cacheIt != m_exactMatchCache.end ())
+    {
+      Ipv4EndPoint *endP = cacheIt->second;
+      if (endP->IsRxEnabled ()
+          && endP->GetLocalPort () == dport && endP->GetLocalAddress () == daddr
+          && endP->GetPeerPort () == sport && endP->GetPeerAddress () == saddr
+          && (!endP->GetBoundNetDevice () || endP->GetBoundNetDevice () == incomingInterface->GetDevice ()))
+        {
+          NS_LOG_LOGIC ("Found a cached endpoint for case 4");
+          return EndPoints (1, endP);
+        }
+      m_exactMatchCache.erase (cacheIt);
+    }
+
   EndPoints retval1; // Matches exact on local port, wildcards on others
   EndPoints retval2; // Matches exact on local port/adder, wildcards on others
   EndPoints retval3; // Matches all but local address
@@ -324,6 +348,11 @@ Ipv4EndPointDemux::Lookup (Ipv4Address daddr, uint16_t dport,
         }
     }
 
+  if (retval4.size () == 1)
+    {
+      m_exactMatchCache[fourTuple] = retval4.front ();
+    }
+
   // Here we find the most exact match
   EndPoints retval;
   if (!retval4.empty ()) retval = retval4;
@@ -23,6 +23,7 @@
 
 #include <stdint.h>
 #include <list>
+#include <map>
 #include "ns3/ipv4-address.h"
 #include "ipv4-interface.h"
 
@@ -192,6 +193,21 @@ private:
    * \brief A list of IPv4 end points.
    */
   EndPoints m_endPoints;
+
+  /**
+   * \brief Four-tuple of a received packet: destination and source
+   *        addresses, destination and source ports.
+   */
+  typedef std::pair<uint64_t, uint32_t> FourTuple_t;
+
+  /**
+   * \brief End points found by Lookup as the only exact match of a
+   *        four-tuple, e.g., the established TCP connections.
+   *
+   * The entries are checked against the end point before being used, and
+   * the cache is flushed whenever an end point is allocated or removed.
+   */
+  std::map<FourTuple_t, Ipv4EndPoint *> m_exactMatchCache;
 };
 
 } // namespace ns3
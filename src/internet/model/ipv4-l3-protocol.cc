@@ -1563,7 +1563,8 @@ Ipv4L3Protocol::ProcessFragment (Ptr<Packet>& packet, Ipv4Header& ipHeader, uint
 }
 
 Ipv4L3Protocol::Fragments::Fragments ()
-  : m_moreFragment (0)
+  : m_moreFragment (0),
+    m_contiguousEnd (0)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -1578,14 +1579,13 @@ Ipv4L3Protocol::Fragments::AddFragment (Ptr<Packet> fragment, uint16_t fragmentO
 {
   NS_LOG_FUNCTION (this << fragment << fragmentOffset << moreFragment);
 
-  std::list<std::pair<Ptr<Packet>, uint16_t> >::iterator it;
+  // Fragments usually arrive in order, so look for the insertion point
+  // starting from the tail of the list.
+  std::list<std::pair<Ptr<Packet>, uint16_t> >::iterator it = m_fragments.end ();
 
-  for (it = m_fragments.begin (); it != m_fragments.end (); it++)
+  while (it != m_fragments.begin () && std::prev (it)->second > fragmentOffset)
     {
-      if (it->second > fragmentOffset)
-        {
-          break;
-        }
+      it--;
     }
 
   if (it == m_fragments.end ())
@@ -1593,7 +1593,15 @@ Ipv4L3Protocol::Fragments::AddFragment (Ptr<Packet> fragment, uint16_t fragmentO
       m_moreFragment = moreFragment;
     }
 
-  m_fragments.insert (it, std::pair<Ptr<Packet>, uint16_t> (fragment, fragmentOffset));
+  it = m_fragments.insert (it, std::pair<Ptr<Packet>, uint16_t> (fragment, fragmentOffset));
+
+  // Extend the gap-free run if the new fragment touches it. Fragments
+  // that follow and were waiting for this hole are folded in as well.
+  for ( ; it != m_fragments.end () && it->second <= m_contiguousEnd; it++)
+    {
+      uint32_t fragmentEnd = it->first->GetSize () + it->second;
+      m_contiguousEnd = std::max (m_contiguousEnd, fragmentEnd);
+    }
 }
 
 bool
@@ -1601,29 +1609,8 @@ Ipv4L3Protocol::Fragments::IsEntire () const
 {
   NS_LOG_FUNCTION (this);
 
-  bool ret = !m_moreFragment && m_fragments.size () > 0;
-
-  if (ret)
-    {
-      uint16_t lastEndOffset = 0;
-
-      for (std::list<std::pair<Ptr<Packet>, uint16_t> >::const_iterator it = m_fragments.begin (); it != m_fragments.end (); it++)
-        {
-          // overlapping fragments do exist
-          NS_LOG_LOGIC ("Checking overlaps " << lastEndOffset << " - " << it->second );
-
-          if (lastEndOffset < it->second)
-            {
-              ret = false;
-              break;
-            }
-          // fragments might overlap in strange ways
-          uint16_t fragmentEnd = it->first->GetSize () + it->second;
-          lastEndOffset = std::max ( lastEndOffset, fragmentEnd );
-        }
-    }
-
-  return ret;
+  return !m_moreFragment && m_fragments.size () > 0
+         && m_fragments.back ().second <= m_contiguousEnd;
 }
 
 Ptr<Packet>
@@ -596,6 +596,14 @@ private:
      */
     std::list<std::pair<Ptr<Packet>, uint16_t> > m_fragments;
 
+    /**
+     * \brief End of the gap-free run of bytes starting at offset 0.
+     *
+     * Every fragment whose offset is not beyond this value has been
+     * accounted for, so IsEntire does not need to walk the list.
+     */
+    uint32_t m_contiguousEnd;
+
     /**
      * \brief Timeout iterator to "event" handler
      */
@@ -668,7 +668,9 @@ void Ipv6ExtensionFragment::HandleTimeout (void)
 
 
 Ipv6ExtensionFragment::Fragments::Fragments ()
-  : m_moreFragment (0)
+  : m_moreFragment (0),
+    m_contiguousEnd (0),
+    m_contiguousCount (0)
 {
 }
 
@@ -679,14 +681,14 @@ Ipv6ExtensionFragment::Fragments::~Fragments ()
 void Ipv6ExtensionFragment::Fragments::AddFragment (Ptr<Packet> fragment, uint16_t fragmentOffset, bool moreFragment)
 {
   NS_LOG_FUNCTION (this << fragment << fragmentOffset << moreFragment);
-  std::list<std::pair<Ptr<Packet>, uint16_t> >::iterator it;
 
-  for (it = m_packetFragments.begin (); it != m_packetFragments.end (); it++)
+  // Fragments usually arrive in order, so look for the insertion point
+  // starting from the tail of the list.
+  std::list<std::pair<Ptr<Packet>, uint16_t> >::iterator it = m_packetFragments.end ();
+
+  while (it != m_packetFragments.begin () && std::prev (it)->second > fragmentOffset)
     {
-      if (it->second > fragmentOffset)
-        {
-          break;
-        }
+      it--;
     }
 
   if (it == m_packetFragments.end ())
@@ -694,7 +696,23 @@ void Ipv6ExtensionFragment::Fragments::AddFragment (Ptr<Packet> fragment, uint16
       m_moreFragment = moreFragment;
     }
 
-  m_packetFragments.insert (it, std::pair<Ptr<Packet>, uint16_t> (fragment, fragmentOffset));
+  it = m_packetFragments.insert (it, std::pair<Ptr<Packet>, uint16_t> (fragment, fragmentOffset));
+
+  // A fragment landing right after the run starting at offset 0 may extend
+  // it, together with any following fragments that were waiting for it.
+  // A fragment landing inside the run overlaps it, and the packet can not
+  // be reassembled anymore.
+  bool extendsRun = (m_contiguousCount == 0) ? (it == m_packetFragments.begin ())
+                                             : (std::prev (it) == m_contiguousLast);
+  if (extendsRun)
+    {
+      for ( ; it != m_packetFragments.end () && it->second == m_contiguousEnd; it++)
+        {
+          m_contiguousEnd += it->first->GetSize ();
+          m_contiguousLast = it;
+          m_contiguousCount++;
+        }
+    }
 }
 
 void Ipv6ExtensionFragment::Fragments::SetUnfragmentablePart (Ptr<Packet> unfragmentablePart)
@@ -705,25 +723,8 @@ void Ipv6ExtensionFragment::Fragments::SetUnfragmentablePart (Ptr<Packet> unfrag
 
 bool Ipv6ExtensionFragment::Fragments::IsEntire () const
 {
-  bool ret = !m_moreFragment && m_packetFragments.size () > 0;
-
-  if (ret)
-    {
-      uint16_t lastEndOffset = 0;
-
-      for (std::list<std::pair<Ptr<Packet>, uint16_t> >::const_iterator it = m_packetFragments.begin (); it != m_packetFragments.end (); it++)
-        {
-          if (lastEndOffset != it->second)
-            {
-              ret = false;
-              break;
-            }
-
-          lastEndOffset += it->first->GetSize ();
-        }
-    }
-
-  return ret;
+  return !m_moreFragment && m_packetFragments.size () > 0
+         && m_contiguousCount == m_packetFragments.size ();
 }
 
 Ptr<Packet> Ipv6ExtensionFragment::Fragments::GetPacket () const
@@ -405,6 +405,21 @@ private:
      */
     std::list<std::pair<Ptr<Packet>, uint16_t> > m_packetFragments;
 
+    /**
+     * \brief End of the run of back-to-back fragments starting at offset 0.
+     */
+    uint32_t m_contiguousEnd;
+
+    /**
+     * \brief Number of fragments in the run starting at offset 0.
+     */
+    uint32_t m_contiguousCount;
+
+    /**
+     * \brief Last fragment of the run starting at offset 0.
+     */
+    std::list<std::pair<Ptr<Packet>, uint16_t> >::iterator m_contiguousLast;
+
     /**
      * \brief The unfragmentable part.
      */
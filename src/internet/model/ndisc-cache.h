@@ -344,6 +344,12 @@ public:
      */
     void SetIpv6Address (Ipv6Address ipv6Address);
 
+    /**
+     * \brief Get the IPv6 address.
+     * \return the IPv6 address
+     */
+    Ipv6Address GetIpv6Address (void) const;
+
     /**
      * \brief Print this entry to the given output stream.
      *
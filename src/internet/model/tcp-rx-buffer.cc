@@ -155,8 +155,14 @@ TcpRxBuffer::Add (Ptr<Packet> p, TcpHeader const& tcph)
       if (maxSeq < tailSeq) tailSeq = maxSeq;
       if (tailSeq < headSeq) headSeq = tailSeq;
     }
-  // Remove overlapped bytes from packet
-  BufIterator i = m_data.begin ();
+  // Remove overlapped bytes from packet. Buffered packets do not overlap,
+  // hence the first one that may overlap with the incoming packet is the
+  // last one starting at or before headSeq.
+  BufIterator i = m_data.upper_bound (headSeq);
+  if (i != m_data.begin ())
+    {
+      --i;
+    }
   while (i != m_data.end () && i->first <= tailSeq)
     {
       SequenceNumber32 lastByteSeq = i->first + SequenceNumber32 (i->second->GetSize ());
@@ -194,7 +200,7 @@ TcpRxBuffer::Add (Ptr<Packet> p, TcpHeader const& tcph)
     }
   // Insert packet into buffer
   NS_ASSERT (m_data.find (headSeq) == m_data.end ()); // Shouldn't be there yet
-  m_data [ headSeq ] = p;
+  m_data.insert (std::make_pair (headSeq, p));
 
   if (headSeq > m_nextRxSeq)
     {
@@ -205,7 +211,8 @@ TcpRxBuffer::Add (Ptr<Packet> p, TcpHeader const& tcph)
   NS_LOG_LOGIC ("Buffered packet of seqno=" << headSeq << " len=" << p->GetSize ());
   // Update variables
   m_size += p->GetSize ();      // Occupancy
-  for (i = m_data.begin (); i != m_data.end (); ++i)
+  // Packets before m_nextRxSeq are already counted as available: skip them
+  for (i = m_data.lower_bound (m_nextRxSeq); i != m_data.end (); ++i)
     {
       if (i->first < m_nextRxSeq)
         {
@@ -369,7 +376,7 @@ TcpRxBuffer::Extract (uint32_t maxSize)
   NS_LOG_LOGIC ("Requested to extract " << extractSize << " bytes from TcpRxBuffer of size=" << m_size);
   if (extractSize == 0) return nullptr;  // No contiguous block to return
   NS_ASSERT (m_data.size ()); // At least we have something to extract
-  Ptr<Packet> outPkt = Create<Packet> (); // The packet that contains all the data to return
+  Ptr<Packet> outPkt; // The packet that contains all the data to return
   BufIterator i;
   while (extractSize)
     { // Check the buffered data for delivery
@@ -379,7 +386,18 @@ TcpRxBuffer::Extract (uint32_t maxSize)
       uint32_t pktSize = i->second->GetSize ();
       if (pktSize <= extractSize)
         { // Whole packet is extracted
-          outPkt->AddAtEnd (i->second);
+          if (outPkt == nullptr)
+            {
+              // The buffered packets are fragments owned by the buffer only:
+              // the first one is handed out as it is, instead of copying it
+              // into a new packet
+              outPkt = i->second;
+              outPkt->RemoveAllPacketTags ();
+            }
+          else
+            {
+              outPkt->AddAtEnd (i->second);
+            }
           m_data.erase (i);
           m_size -= pktSize;
           m_availBytes -= pktSize;
@@ -387,7 +405,15 @@ TcpRxBuffer::Extract (uint32_t maxSize)
         }
       else
         { // Partial is extracted and done
-          outPkt->AddAtEnd (i->second->CreateFragment (0, extractSize));
+          if (outPkt == nullptr)
+            {
+              outPkt = i->second->CreateFragment (0, extractSize);
+              outPkt->RemoveAllPacketTags ();
+            }
+          else
+            {
+              outPkt->AddAtEnd (i->second->CreateFragment (0, extractSize));
+            }
           m_data[i->first + SequenceNumber32 (extractSize)] = i->second->CreateFragment (extractSize, pktSize - extractSize);
           m_data.erase (i);
           m_size -= extractSize;
@@ -395,7 +421,7 @@ TcpRxBuffer::Extract (uint32_t maxSize)
           extractSize = 0;
         }
     }
-  if (outPkt->GetSize () == 0)
+  if (outPkt == nullptr || outPkt->GetSize () == 0)
     {
       NS_LOG_LOGIC ("Nothing extracted.");
       return nullptr;
@@ -3160,8 +3160,11 @@ TcpSocketBase::SendDataPacket (SequenceNumber32 seq, uint32_t maxSize, bool with
   // Notify the application of the data being sent unless this is a retransmit
   if (!isRetransmission)
     {
-      Simulator::ScheduleNow (&TcpSocketBase::NotifyDataSent, this,
-                              (seq + sz - m_tcb->m_highTxMark.Get ()));
+      m_dataSentPending += (seq + sz - m_tcb->m_highTxMark.Get ());
+      if (!m_dataSentEvent.IsRunning ())
+        {
+          m_dataSentEvent = Simulator::ScheduleNow (&TcpSocketBase::NotifyPendingDataSent, this);
+        }
     }
   // Update highTxMark
   m_tcb->m_highTxMark = std::max (seq + sz, m_tcb->m_highTxMark.Get ());
@@ -3193,6 +3196,15 @@ TcpSocketBase::UpdateRttHistory (const SequenceNumber32 &seq, uint32_t sz,
     }
 }
 
+void
+TcpSocketBase::NotifyPendingDataSent (void)
+{
+  NS_LOG_FUNCTION (this << m_dataSentPending);
+  uint32_t size = m_dataSentPending;
+  m_dataSentPending = 0;
+  NotifyDataSent (size);
+}
+
 // Note that this function did not implement the PSH flag
 uint32_t
 TcpSocketBase::SendPendingData (bool withAck)
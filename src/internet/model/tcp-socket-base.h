@@ -1030,6 +1030,15 @@ protected:
   virtual void UpdateRttHistory (const SequenceNumber32 &seq, uint32_t sz,
                                  bool isRetransmission);
 
+  /**
+   * \brief Notify the application of the new data sent since the last
+   *        notification
+   *
+   * The segments sent back-to-back (e.g., by SendPendingData) are
+   * notified with a single callback, instead of one event per segment.
+   */
+  void NotifyPendingDataSent (void);
+
   /**
    * \brief Update buffers w.r.t. ACK
    * \param seq the sequence number
@@ -1249,6 +1258,8 @@ protected:
   EventId           m_delAckEvent   {}; //!< Delayed ACK timeout event
   EventId           m_persistEvent  {}; //!< Persist event: Send 1 byte to probe for a non-zero Rx window
   EventId           m_timewaitEvent {}; //!< TIME_WAIT expiration event: Move this socket to CLOSED state
+  EventId           m_dataSentEvent {}; //!< Event notifying the application of the data sent
+  uint32_t          m_dataSentPending {0}; //!< New data sent and not yet notified to the application
 
   // ACK management
   uint32_t          m_dupAckCount {0};     //!< Dupack counter
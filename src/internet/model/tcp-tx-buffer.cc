@@ -796,7 +796,7 @@ TcpTxBuffer::Update (const TcpOptionSack::SackList &list,
 
   for (auto option_it = list.begin (); option_it != list.end (); ++option_it)
     {
-      PacketList::iterator item_it = m_sentList.begin ();
+      PacketList::const_iterator item_it = m_sentList.begin ();
       SequenceNumber32 beginOfCurrentPacket = m_firstByteSeq;
 
       if (m_firstByteSeq + m_sentSize < (*option_it).first)
@@ -805,6 +805,17 @@ TcpTxBuffer::Update (const TcpOptionSack::SackList &list,
           return bytesSacked;
         }
 
+      // Blocks starting above the highest sacked item (the common case, as
+      // the receiver reports new data above the hole) cannot touch any item
+      // before it: start the walk from there instead of from the head.
+      if (m_highestSack.first != m_sentList.end ()
+          && (*m_highestSack.first)->m_startSeq == m_highestSack.second
+          && (*option_it).first >= m_highestSack.second)
+        {
+          item_it = m_highestSack.first;
+          beginOfCurrentPacket = m_highestSack.second;
+        }
+
       while (item_it != m_sentList.end ())
         {
           uint32_t pktSize = (*item_it)->m_packet->GetSize ();
@@ -908,7 +919,15 @@ TcpTxBuffer::UpdateLostCount ()
 
       if (sacked >= m_dupAckThresh)
         {
-          if (!item->m_sacked && !item->m_lost)
+          if (item->m_lost)
+            {
+              // Items are marked lost walking down to the head, and only
+              // lose the flag when sacked: every item before this one has
+              // already been marked (or sacked) by a previous update.
+              NS_LOG_INFO ("Reached item " << *item << " already lost, stopping");
+              break;
+            }
+          if (!item->m_sacked)
             {
               item->m_lost = true;
               m_lostOut += item->m_packet->GetSize ();
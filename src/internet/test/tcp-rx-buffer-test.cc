@@ -44,6 +44,12 @@ private:
    * \brief Test the SACK list update.
    */
   void TestUpdateSACKList ();
+
+  /**
+   * \brief Test the reassembly of overlapping, out-of-order segments and
+   *        the extraction of contiguous data.
+   */
+  void TestReassembly ();
 };
 
 TcpRxBufferTestCase::TcpRxBufferTestCase ()
@@ -55,6 +61,7 @@ void
 TcpRxBufferTestCase::DoRun ()
 {
   TestUpdateSACKList ();
+  TestReassembly ();
 }
 
 void
@@ -338,6 +345,49 @@ TcpRxBufferTestCase::TestUpdateSACKList ()
                          "SACK list should contain no element");
 }
 
+void
+TcpRxBufferTestCase::TestReassembly ()
+{
+  TcpRxBuffer rxBuf;
+  TcpHeader h;
+  rxBuf.SetNextRxSequence (SequenceNumber32 (1));
+
+  // Three out-of-order segments: [201;301), [401;501) and [301;401)
+  h.SetSequenceNumber (SequenceNumber32 (201));
+  NS_TEST_ASSERT_MSG_EQ (rxBuf.Add (Create<Packet> (100), h), true, "Segment not buffered");
+  h.SetSequenceNumber (SequenceNumber32 (401));
+  NS_TEST_ASSERT_MSG_EQ (rxBuf.Add (Create<Packet> (100), h), true, "Segment not buffered");
+  h.SetSequenceNumber (SequenceNumber32 (301));
+  NS_TEST_ASSERT_MSG_EQ (rxBuf.Add (Create<Packet> (100), h), true, "Segment not buffered");
+
+  NS_TEST_ASSERT_MSG_EQ (rxBuf.Size (), 300, "Wrong buffer occupancy");
+  NS_TEST_ASSERT_MSG_EQ (rxBuf.Available (), 0, "Data available with a hole at the head");
+  NS_TEST_ASSERT_MSG_EQ ((rxBuf.Extract (1000) == nullptr), true, "Extracted data beyond a hole");
+
+  // A duplicate fully covered by buffered data is not stored
+  h.SetSequenceNumber (SequenceNumber32 (251));
+  NS_TEST_ASSERT_MSG_EQ (rxBuf.Add (Create<Packet> (100), h), false, "Duplicate segment buffered");
+
+  // A segment overlapping the head of the buffered data fills the hole
+  h.SetSequenceNumber (SequenceNumber32 (1));
+  NS_TEST_ASSERT_MSG_EQ (rxBuf.Add (Create<Packet> (250), h), true, "Segment not buffered");
+  NS_TEST_ASSERT_MSG_EQ (rxBuf.Size (), 500, "Wrong buffer occupancy");
+  NS_TEST_ASSERT_MSG_EQ (rxBuf.Available (), 500, "Wrong available data");
+  NS_TEST_ASSERT_MSG_EQ (rxBuf.NextRxSequence (), SequenceNumber32 (501),
+                         "Sequence number differs from expected");
+  NS_TEST_ASSERT_MSG_EQ (rxBuf.GetSackListSize (), 0, "SACK list should be empty");
+
+  // Extractions within a single segment, across segments and of the rest
+  Ptr<Packet> out = rxBuf.Extract (150);
+  NS_TEST_ASSERT_MSG_EQ (out->GetSize (), 150, "Wrong extracted size");
+  out = rxBuf.Extract (200);
+  NS_TEST_ASSERT_MSG_EQ (out->GetSize (), 200, "Wrong extracted size");
+  out = rxBuf.Extract (1000);
+  NS_TEST_ASSERT_MSG_EQ (out->GetSize (), 150, "Wrong extracted size");
+  NS_TEST_ASSERT_MSG_EQ (rxBuf.Size (), 0, "Buffer should be empty");
+  NS_TEST_ASSERT_MSG_EQ ((rxBuf.Extract (1000) == nullptr), true, "Extracted data from an empty buffer");
+}
+
 void
 TcpRxBufferTestCase::DoTeardown ()
 {
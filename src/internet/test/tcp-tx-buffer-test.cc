@@ -44,6 +44,8 @@ private:
 
   /** \brief Test if a segment is really set as lost */
   void TestIsLost ();
+  /** \brief Test the lost and sacked counters with several holes */
+  void TestLostCount ();
   /** \brief Test the generation of an unsent block */
   void TestNewBlock ();
   /** \brief Test the generation of a previously sent block */
@@ -66,6 +68,12 @@ void
 TcpTxBufferTestCase::DoRun ()
 {
   Simulator::Schedule (Seconds (0.0), &TcpTxBufferTestCase::TestIsLost, this);
+  /*
+   * Cases for the scoreboard counters:
+   * -> blocks arriving above the highest sacked segment
+   * -> a second hole, with less than dupThresh sacked segments above it
+   */
+  Simulator::Schedule (Seconds (0.0), &TcpTxBufferTestCase::TestLostCount, this);
   /*
    * Cases for new block:
    * -> is exactly the same as stored
@@ -150,6 +158,59 @@ TcpTxBufferTestCase::TestIsLost ()
 
 }
 
+void
+TcpTxBufferTestCase::TestLostCount ()
+{
+  Ptr<TcpTxBuffer> txBuf = CreateObject<TcpTxBuffer> ();
+  txBuf->SetRWndCallback (MakeCallback (&TcpTxBufferTestCase::GetRWnd, this));
+  txBuf->SetHeadSequence (SequenceNumber32 (1));
+  txBuf->SetSegmentSize (1000);
+  txBuf->SetDupAckThresh (3);
+  Ptr<TcpOptionSack> sack = CreateObject<TcpOptionSack> ();
+
+  txBuf->Add (Create<Packet> (10000));
+  for (uint8_t i = 0; i < 10; ++i)
+    {
+      txBuf->CopyFromSequence (1000, SequenceNumber32 ((i * 1000) + 1));
+    }
+
+  // segments 4, 5 and 6 are sacked: the first four are lost
+  for (uint8_t i = 4; i < 7; ++i)
+    {
+      sack->ClearSackList ();
+      sack->AddSackBlock (TcpOptionSack::SackBlock (SequenceNumber32 ((i * 1000) + 1),
+                                                    SequenceNumber32 (((i + 1) * 1000) + 1)));
+      txBuf->Update (sack->GetSackList ());
+    }
+  NS_TEST_ASSERT_MSG_EQ (txBuf->GetSacked (), 3000, "Wrong sacked count");
+  NS_TEST_ASSERT_MSG_EQ (txBuf->GetLost (), 4000, "Wrong lost count");
+
+  // segments 8 and 9 are sacked: segment 7 is not lost, the others are unchanged
+  for (uint8_t i = 8; i < 10; ++i)
+    {
+      sack->ClearSackList ();
+      sack->AddSackBlock (TcpOptionSack::SackBlock (SequenceNumber32 ((i * 1000) + 1),
+                                                    SequenceNumber32 (((i + 1) * 1000) + 1)));
+      txBuf->Update (sack->GetSackList ());
+    }
+  NS_TEST_ASSERT_MSG_EQ (txBuf->GetSacked (), 5000, "Wrong sacked count");
+  NS_TEST_ASSERT_MSG_EQ (txBuf->GetLost (), 4000, "Wrong lost count");
+  NS_TEST_ASSERT_MSG_EQ (txBuf->BytesInFlight (), 1000, "Wrong bytes in flight");
+
+  for (uint8_t i = 0; i < 10; ++i)
+    {
+      NS_TEST_ASSERT_MSG_EQ (txBuf->IsLost (SequenceNumber32 ((i * 1000) + 1)), (i < 4),
+                             "Wrong lost status for segment " << (uint32_t) i);
+    }
+
+  // a late block for segment 7 does not change the lost segments
+  sack->ClearSackList ();
+  sack->AddSackBlock (TcpOptionSack::SackBlock (SequenceNumber32 (7001), SequenceNumber32 (8001)));
+  NS_TEST_ASSERT_MSG_EQ (txBuf->Update (sack->GetSackList ()), 1000, "Wrong sacked bytes");
+  NS_TEST_ASSERT_MSG_EQ (txBuf->GetSacked (), 6000, "Wrong sacked count");
+  NS_TEST_ASSERT_MSG_EQ (txBuf->GetLost (), 4000, "Wrong lost count");
+}
+
 uint32_t
 TcpTxBufferTestCase::GetRWnd (void) const
 {
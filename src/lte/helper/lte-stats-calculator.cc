@@ -22,6 +22,7 @@
 
 #include <ns3/log.h>
 #include <ns3/config.h>
+#include <ns3/simulator.h>
 #include <ns3/lte-enb-rrc.h>
 #include <ns3/lte-ue-rrc.h>
 #include <ns3/lte-enb-net-device.h>
@@ -43,7 +44,8 @@ LteStatsCalculator::LteStatsCalculator ()
 
 LteStatsCalculator::~LteStatsCalculator ()
 {
-  // Nothing to do here
+  // the streams are closed (and flushed) by the derived classes
+  m_flushEvent.Cancel ();
 }
 
 
@@ -309,4 +311,35 @@ LteStatsCalculator::FindImsiForUe (std::string path, uint16_t rnti)
 }
 
 
+bool
+LteStatsCalculator::OpenOutputFile (std::ofstream &outFile, std::string filename)
+{
+  NS_LOG_FUNCTION (this << filename);
+  outFile.open (filename.c_str ());
+  if (!outFile.is_open ())
+    {
+      NS_LOG_ERROR ("Can't open file " << filename.c_str ());
+      return false;
+    }
+  m_outputFiles.push_back (&outFile);
+  if (!m_flushEvent.IsRunning ())
+    {
+      m_flushEvent = Simulator::ScheduleDestroy (&LteStatsCalculator::FlushOutputFiles, this);
+    }
+  return true;
+}
+
+void
+LteStatsCalculator::FlushOutputFiles (void)
+{
+  NS_LOG_FUNCTION (this);
+  for (std::vector<std::ofstream *>::iterator it = m_outputFiles.begin (); it != m_outputFiles.end (); ++it)
+    {
+      if ((*it)->is_open ())
+        {
+          (*it)->flush ();
+        }
+    }
+}
+
 } // namespace ns3
@@ -23,7 +23,10 @@
 
 #include "ns3/object.h"
 #include "ns3/string.h"
+#include "ns3/event-id.h"
 #include <map>
+#include <vector>
+#include <fstream>
 
 namespace ns3 {
 
@@ -184,7 +187,33 @@ protected:
    */
   static uint64_t FindImsiForUe (std::string path, uint16_t rnti);
 
+  /**
+   * Opens an output file, truncating it. The caller is expected to keep
+   * the stream open and to write all its records to it, so that the file
+   * is not reopened for every record. The stream is flushed when the
+   * simulation is destroyed, and closed when the stream is destroyed.
+   * @param outFile the output stream to open
+   * @param filename the name of the file
+   * @return true if the file was opened, false otherwise
+   */
+  bool OpenOutputFile (std::ofstream &outFile, std::string filename);
+
 private:
+  /**
+   * Flushes all the output streams opened with OpenOutputFile
+   */
+  void FlushOutputFiles (void);
+
+  /**
+   * Output streams opened with OpenOutputFile
+   */
+  std::vector<std::ofstream *> m_outputFiles;
+
+  /**
+   * Event flushing the output streams when the simulation is destroyed
+   */
+  EventId m_flushEvent;
+
   /**
    * List of IMSI by path in the attribute system
    */
@@ -151,20 +151,16 @@ public:
 
 private:
   /**
-   * When writing DL MAC statistics first time to file,
-   * columns description is added. Then next lines are
-   * appended to file. This value is true if output
-   * files have not been opened yet
+   * Output stream of the downlink statistics, opened at the first write
+   * and kept open for the following ones
    */
-  bool m_dlFirstWrite;
+  std::ofstream m_dlOutFile;
 
   /**
-   * When writing UL MAC statistics first time to file,
-   * columns description is added. Then next lines are
-   * appended to file. This value is true if output
-   * files have not been opened yet
+   * Output stream of the uplink statistics, opened at the first write
+   * and kept open for the following ones
    */
-  bool m_ulFirstWrite;
+  std::ofstream m_ulOutFile;
 
 };
 
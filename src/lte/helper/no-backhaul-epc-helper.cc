@@ -149,6 +149,7 @@ NoBackhaulEpcHelper::NoBackhaulEpcHelper ()
 
   // Create EpcPgwApplication
   m_pgwApp = CreateObject<EpcPgwApplication> (m_tunDevice, pgwS5Address, pgwS5uSocket, pgwS5cSocket);
+  m_pgwApp->SetAttribute ("GtpuFastPath", BooleanValue (m_gtpuFastPath));
   m_pgw->AddApplication (m_pgwApp);
 
   // Connect EpcPgwApplication and virtual net device for tunneling
@@ -172,6 +173,7 @@ NoBackhaulEpcHelper::NoBackhaulEpcHelper ()
 
   // Create EpcSgwApplication
   m_sgwApp = CreateObject<EpcSgwApplication> (sgwS1uSocket, sgwS5Address, sgwS5uSocket, sgwS5cSocket);
+  m_sgwApp->SetAttribute ("GtpuFastPath", BooleanValue (m_gtpuFastPath));
   m_sgw->AddApplication (m_sgwApp);
   m_sgwApp->AddPgw (pgwS5Address);
   m_pgwApp->AddSgw (sgwS5Address);
@@ -281,6 +283,12 @@ NoBackhaulEpcHelper::GetTypeId (void)
                    BooleanValue (false),
                    MakeBooleanAccessor (&NoBackhaulEpcHelper::m_x2LinkEnablePcap),
                    MakeBooleanChecker ())
+    .AddAttribute ("GtpuFastPath",
+                   "Value of the GtpuFastPath attribute of the EpcPgwApplication, "
+                   "EpcSgwApplication and EpcEnbApplication instances created by this helper",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&NoBackhaulEpcHelper::m_gtpuFastPath),
+                   MakeBooleanChecker ())
   ;
   return tid;
 }
@@ -349,6 +357,7 @@ NoBackhaulEpcHelper::AddEnb (Ptr<Node> enb, Ptr<NetDevice> lteEnbNetDevice, uint
 
   NS_LOG_INFO ("Create EpcEnbApplication");
   Ptr<EpcEnbApplication> enbApp = CreateObject<EpcEnbApplication> (enbLteSocket, enbLteSocket6, cellId);
+  enbApp->SetAttribute ("GtpuFastPath", BooleanValue (m_gtpuFastPath));
   enb->AddApplication (enbApp);
   NS_ASSERT (enb->GetNApplications () == 1);
   NS_ASSERT_MSG (enb->GetApplication (0)->GetObject<EpcEnbApplication> () != 0, "cannot retrieve EpcEnbApplication");
@@ -240,6 +240,12 @@ private:
    */
   std::string m_x2LinkPcapPrefix;
 
+  /**
+   * Whether the EPC applications tunnel user data with a GtpuTag
+   * instead of a GtpuHeader
+   */
+  bool m_gtpuFastPath;
+
 };
 
 } // namespace ns3
@@ -127,20 +127,16 @@ public:
 private:
 
   /**
-   * When writing DL RX PHY statistics first time to file,
-   * columns description is added. Then next lines are
-   * appended to file. This value is true if output
-   * files have not been opened yet
+   * Output stream of the downlink statistics, opened at the first write
+   * and kept open for the following ones
    */
-  bool m_dlRxFirstWrite;
+  std::ofstream m_dlRxOutFile;
 
   /**
-   * When writing UL RX PHY statistics first time to file,
-   * columns description is added. Then next lines are
-   * appended to file. This value is true if output
-   * files have not been opened yet
+   * Output stream of the uplink statistics, opened at the first write
+   * and kept open for the following ones
    */
-  bool m_ulRxFirstWrite;
+  std::ofstream m_ulRxOutFile;
 
 };
 
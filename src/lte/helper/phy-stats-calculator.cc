@@ -31,9 +31,6 @@ NS_LOG_COMPONENT_DEFINE ("PhyStatsCalculator");
 NS_OBJECT_ENSURE_REGISTERED (PhyStatsCalculator);
 
 PhyStatsCalculator::PhyStatsCalculator ()
-  :  m_RsrpSinrFirstWrite (true),
-     m_UeSinrFirstWrite (true),
-     m_InterferenceFirstWrite (true)
 {
   NS_LOG_FUNCTION (this);
 
@@ -115,37 +112,23 @@ PhyStatsCalculator::ReportCurrentCellRsrpSinr (uint16_t cellId, uint64_t imsi, u
   NS_LOG_FUNCTION (this << cellId <<  imsi << rnti  << rsrp << sinr);
   NS_LOG_INFO ("Write RSRP/SINR Phy Stats in " << GetCurrentCellRsrpSinrFilename ().c_str ());
 
-  std::ofstream outFile;
-  if ( m_RsrpSinrFirstWrite == true )
+  if (!m_rsrpSinrOutFile.is_open ())
     {
-      outFile.open (GetCurrentCellRsrpSinrFilename ().c_str ());
-      if (!outFile.is_open ())
+      if (!OpenOutputFile (m_rsrpSinrOutFile, GetCurrentCellRsrpSinrFilename ()))
         {
-          NS_LOG_ERROR ("Can't open file " << GetCurrentCellRsrpSinrFilename ().c_str ());
-          return;
-        }
-      m_RsrpSinrFirstWrite = false;
-      outFile << "% time\tcellId\tIMSI\tRNTI\trsrp\tsinr\tComponentCarrierId";
-      outFile << std::endl;
-    }
-  else
-    {
-      outFile.open (GetCurrentCellRsrpSinrFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetCurrentCellRsrpSinrFilename ().c_str ());
           return;
         }
+      m_rsrpSinrOutFile << "% time\tcellId\tIMSI\tRNTI\trsrp\tsinr\tComponentCarrierId";
+      m_rsrpSinrOutFile << "\n";
     }
 
-  outFile << Simulator::Now ().GetSeconds () << "\t";
-  outFile << cellId << "\t";
-  outFile << imsi << "\t";
-  outFile << rnti << "\t";
-  outFile << rsrp << "\t";
-  outFile << sinr << "\t";
-  outFile << (uint32_t)componentCarrierId << std::endl;
-  outFile.close ();
+  m_rsrpSinrOutFile << Simulator::Now ().GetSeconds () << "\t";
+  m_rsrpSinrOutFile << cellId << "\t";
+  m_rsrpSinrOutFile << imsi << "\t";
+  m_rsrpSinrOutFile << rnti << "\t";
+  m_rsrpSinrOutFile << rsrp << "\t";
+  m_rsrpSinrOutFile << sinr << "\t";
+  m_rsrpSinrOutFile << (uint32_t)componentCarrierId << "\n";
 }
 
 void
@@ -154,36 +137,22 @@ PhyStatsCalculator::ReportUeSinr (uint16_t cellId, uint64_t imsi, uint16_t rnti,
   NS_LOG_FUNCTION (this << cellId <<  imsi << rnti  << sinrLinear);
   NS_LOG_INFO ("Write SINR Linear Phy Stats in " << GetUeSinrFilename ().c_str ());
 
-  std::ofstream outFile;
-  if ( m_UeSinrFirstWrite == true )
-    {
-      outFile.open (GetUeSinrFilename ().c_str ());
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetUeSinrFilename ().c_str ());
-          return;
-        }
-      m_UeSinrFirstWrite = false;
-      outFile << "% time\tcellId\tIMSI\tRNTI\tsinrLinear\tcomponentCarrierId";
-      outFile << std::endl;
-    }
-  else
+  if (!m_ueSinrOutFile.is_open ())
     {
-      outFile.open (GetUeSinrFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
+      if (!OpenOutputFile (m_ueSinrOutFile, GetUeSinrFilename ()))
         {
-          NS_LOG_ERROR ("Can't open file " << GetUeSinrFilename ().c_str ());
           return;
         }
+      m_ueSinrOutFile << "% time\tcellId\tIMSI\tRNTI\tsinrLinear\tcomponentCarrierId";
+      m_ueSinrOutFile << "\n";
     }
 
-  outFile << Simulator::Now ().GetSeconds () << "\t";
-  outFile << cellId << "\t";
-  outFile << imsi << "\t";
-  outFile << rnti << "\t";
-  outFile << sinrLinear << "\t";
-  outFile << (uint32_t)componentCarrierId << std::endl;
-  outFile.close ();
+  m_ueSinrOutFile << Simulator::Now ().GetSeconds () << "\t";
+  m_ueSinrOutFile << cellId << "\t";
+  m_ueSinrOutFile << imsi << "\t";
+  m_ueSinrOutFile << rnti << "\t";
+  m_ueSinrOutFile << sinrLinear << "\t";
+  m_ueSinrOutFile << (uint32_t)componentCarrierId << "\n";
 }
 
 void
@@ -192,33 +161,24 @@ PhyStatsCalculator::ReportInterference (uint16_t cellId, Ptr<SpectrumValue> inte
   NS_LOG_FUNCTION (this << cellId <<  interference);
   NS_LOG_INFO ("Write Interference Phy Stats in " << GetInterferenceFilename ().c_str ());
 
-  std::ofstream outFile;
-  if ( m_InterferenceFirstWrite == true )
+  if (!m_interferenceOutFile.is_open ())
     {
-      outFile.open (GetInterferenceFilename ().c_str ());
-      if (!outFile.is_open ())
+      if (!OpenOutputFile (m_interferenceOutFile, GetInterferenceFilename ()))
         {
-          NS_LOG_ERROR ("Can't open file " << GetInterferenceFilename ().c_str ());
           return;
         }
-      m_InterferenceFirstWrite = false;
-      outFile << "% time\tcellId\tInterference";
-      outFile << std::endl;
+      m_interferenceOutFile << "% time\tcellId\tInterference";
+      m_interferenceOutFile << "\n";
     }
-  else
+
+  m_interferenceOutFile << Simulator::Now ().GetSeconds () << "\t";
+  m_interferenceOutFile << cellId << "\t";
+  // SpectrumValue::operator << ends with std::endl, which would flush the stream
+  for (Values::const_iterator it = interference->ConstValuesBegin (); it != interference->ConstValuesEnd (); ++it)
     {
-      outFile.open (GetInterferenceFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetInterferenceFilename ().c_str ());
-          return;
-        }
+      m_interferenceOutFile << *it << " ";
     }
-
-  outFile << Simulator::Now ().GetSeconds () << "\t";
-  outFile << cellId << "\t";
-  outFile << *interference;
-  outFile.close ();
+  m_interferenceOutFile << "\n";
 }
 
 
@@ -183,28 +183,22 @@ public:
 
 private:
   /**
-   * When writing RSRP SINR statistics first time to file,
-   * columns description is added. Then next lines are
-   * appended to file. This value is true if output
-   * files have not been opened yet
+   * Output stream of the RSRP/SINR statistics, opened at the first write
+   * and kept open for the following ones
    */
-  bool m_RsrpSinrFirstWrite;
+  std::ofstream m_rsrpSinrOutFile;
 
   /**
-   * When writing UE SINR statistics first time to file,
-   * columns description is added. Then next lines are
-   * appended to file. This value is true if output
-   * files have not been opened yet
+   * Output stream of the UE SINR statistics, opened at the first write
+   * and kept open for the following ones
    */
-  bool m_UeSinrFirstWrite;
+  std::ofstream m_ueSinrOutFile;
 
   /**
-   * When writing interference statistics first time to file,
-   * columns description is added. Then next lines are
-   * appended to file. This value is true if output
-   * files have not been opened yet
+   * Output stream of the interference statistics, opened at the first write
+   * and kept open for the following ones
    */
-  bool m_InterferenceFirstWrite;
+  std::ofstream m_interferenceOutFile;
 
   /**
    * Name of the file where the RSRP/SINR statistics will be saved
@@ -128,20 +128,16 @@ public:
 
 private:
   /**
-   * When writing DL TX PHY statistics first time to file,
-   * columns description is added. Then next lines are
-   * appended to file. This value is true if output
-   * files have not been opened yet
+   * Output stream of the downlink statistics, opened at the first write
+   * and kept open for the following ones
    */
-  bool m_dlTxFirstWrite;
+  std::ofstream m_dlTxOutFile;
 
   /**
-   * When writing UL TX PHY statistics first time to file,
-   * columns description is added. Then next lines are
-   * appended to file. This value is true if output
-   * files have not been opened yet
+   * Output stream of the uplink statistics, opened at the first write
+   * and kept open for the following ones
    */
-  bool m_ulTxFirstWrite;
+  std::ofstream m_ulTxOutFile;
 
 };
 
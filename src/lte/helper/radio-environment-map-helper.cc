@@ -37,6 +37,11 @@
 #include <ns3/node.h>
 #include <ns3/buildings-helper.h>
 #include <ns3/lte-spectrum-value-helper.h>
+#include <ns3/lte-spectrum-signal-parameters.h>
+#include <ns3/spectrum-converter.h>
+#include <ns3/propagation-loss-model.h>
+#include <ns3/spectrum-propagation-loss-model.h>
+#include <ns3/antenna-model.h>
 
 #include <fstream>
 #include <limits>
@@ -144,6 +149,12 @@ RadioEnvironmentMapHelper::GetTypeId (void)
                    IntegerValue (-1),
                    MakeIntegerAccessor (&RadioEnvironmentMapHelper::m_rbId),
                    MakeIntegerChecker<int32_t> ())
+    .AddAttribute ("Offline",
+                   "If true, the transmissions of a single subframe are captured from the channel "
+                   "and the map is computed directly from them, without attaching listeners to the channel",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&RadioEnvironmentMapHelper::m_offline),
+                   MakeBooleanChecker ())
   ;
   return tid;
 }
@@ -181,7 +192,8 @@ void
 RadioEnvironmentMapHelper::Install ()
 {
   NS_LOG_FUNCTION (this);
-  if (!m_rem.empty ())
+  // m_channel is set by the first call, both in online and offline mode
+  if (m_channel != 0)
     {
       NS_FATAL_ERROR ("only one REM supported per instance of RadioEnvironmentMapHelper");
     }
@@ -208,6 +220,16 @@ RadioEnvironmentMapHelper::Install ()
       startDelay = 0.5001;
     }
 
+  if (m_offline)
+    {
+      // same timing of the first iteration of the online generation, so
+      // that the transmissions of exactly one subframe are captured
+      Simulator::Schedule (Seconds (startDelay + 0.0001),
+                           &RadioEnvironmentMapHelper::StartCapture,
+                           this);
+      return;
+    }
+
   Simulator::Schedule (Seconds (startDelay),
                        &RadioEnvironmentMapHelper::DelayedInstall,
                        this);
@@ -353,4 +375,143 @@ RadioEnvironmentMapHelper::Finalize ()
 }
 
 
+void
+RadioEnvironmentMapHelper::StartCapture ()
+{
+  NS_LOG_FUNCTION (this);
+  m_xStep = (m_xMax - m_xMin)/(m_xRes-1);
+  m_yStep = (m_yMax - m_yMin)/(m_yRes-1);
+  m_capturedTx.clear ();
+  m_channel->TraceConnectWithoutContext ("TxSigParams", MakeCallback (&RadioEnvironmentMapHelper::CaptureTransmission, this));
+  Simulator::Schedule (Seconds (0.0005), &RadioEnvironmentMapHelper::RunOffline, this);
+}
+
+void
+RadioEnvironmentMapHelper::CaptureTransmission (Ptr<SpectrumSignalParameters> params)
+{
+  NS_LOG_FUNCTION (this << params);
+  bool capture = m_useDataChannel
+    ? DynamicCast<LteSpectrumSignalParametersDataFrame> (params) != 0
+    : DynamicCast<LteSpectrumSignalParametersDlCtrlFrame> (params) != 0;
+  if (capture)
+    {
+      m_capturedTx.push_back (params);
+    }
+}
+
+void
+RadioEnvironmentMapHelper::RunOffline ()
+{
+  NS_LOG_FUNCTION (this);
+  m_channel->TraceDisconnectWithoutContext ("TxSigParams", MakeCallback (&RadioEnvironmentMapHelper::CaptureTransmission, this));
+  NS_LOG_LOGIC ("captured " << m_capturedTx.size () << " transmissions");
+
+  Ptr<const SpectrumModel> rxSpectrumModel = LteSpectrumValueHelper::GetSpectrumModel (m_earfcn, m_bandwidth);
+  Ptr<PropagationLossModel> propagationLoss = m_channel->GetPropagationLossModel ();
+  Ptr<SpectrumPropagationLossModel> spectrumPropagationLoss = m_channel->GetSpectrumPropagationLossModel ();
+  DoubleValue maxLossDb;
+  m_channel->GetAttribute ("MaxLossDb", maxLossDb);
+
+  // convert the transmitted PSDs to the spectrum model of the map once,
+  // as the channel does for every receiver
+  std::vector<Ptr<SpectrumValue> > txPsds;
+  std::vector<Ptr<MobilityModel> > txMobilities;
+  std::vector<Ptr<AntennaModel> > txAntennas;
+  for (std::vector<Ptr<SpectrumSignalParameters> >::const_iterator it = m_capturedTx.begin ();
+       it != m_capturedTx.end ();
+       ++it)
+    {
+      Ptr<SpectrumValue> psd;
+      if ((*it)->psd->GetSpectrumModelUid () == rxSpectrumModel->GetUid ())
+        {
+          psd = (*it)->psd;
+        }
+      else if (!(*it)->psd->GetSpectrumModel ()->IsOrthogonal (*rxSpectrumModel))
+        {
+          psd = SpectrumConverter ((*it)->psd->GetSpectrumModel (), rxSpectrumModel).Convert ((*it)->psd);
+        }
+      Ptr<MobilityModel> txMobility = (*it)->txPhy->GetMobility ();
+      if (psd != 0 && txMobility != 0)
+        {
+          txPsds.push_back (psd);
+          txMobilities.push_back (txMobility);
+          txAntennas.push_back ((*it)->txAntenna);
+        }
+    }
+
+  // the points are mapped to the mobility models in the same way as they
+  // are mapped to the listeners by the online generation, so that the
+  // propagation models caching values per pair of mobility models (e.g.,
+  // shadowing) behave in the same way
+  uint32_t numMobilities = m_maxPointsPerIteration;
+  if ((double)m_xRes * (double) m_yRes < (double) numMobilities)
+    {
+      numMobilities = m_xRes * m_yRes;
+    }
+  std::vector<Ptr<MobilityModel> > mobilities;
+  mobilities.reserve (numMobilities);
+  for (uint32_t i = 0; i < numMobilities; ++i)
+    {
+      Ptr<MobilityModel> mm = CreateObject<ConstantPositionMobilityModel> ();
+      mm->AggregateObject (CreateObject<MobilityBuildingInfo> ());
+      mobilities.push_back (mm);
+    }
+
+  uint32_t pointIndex = 0;
+  for (double x = m_xMin; x < m_xMax + 0.5*m_xStep; x += m_xStep)
+    {
+      for (double y = m_yMin; y < m_yMax + 0.5*m_yStep ; y += m_yStep)
+        {
+          Ptr<MobilityModel> rxMobility = mobilities[pointIndex % numMobilities];
+          ++pointIndex;
+          rxMobility->SetPosition (Vector (x, y, m_z));
+          rxMobility->GetObject<MobilityBuildingInfo> ()->MakeConsistent (rxMobility);
+
+          double referenceSignalPower = 0;
+          double sumPower = 0;
+          for (uint32_t i = 0; i < txPsds.size (); ++i)
+            {
+              double pathLossDb = 0;
+              if (txAntennas[i] != 0)
+                {
+                  Angles txAngles (rxMobility->GetPosition (), txMobilities[i]->GetPosition ());
+                  pathLossDb -= txAntennas[i]->GetGainDb (txAngles);
+                }
+              if (propagationLoss)
+                {
+                  pathLossDb -= propagationLoss->CalcRxPower (0, txMobilities[i], rxMobility);
+                }
+              if (pathLossDb > maxLossDb.Get ())
+                {
+                  continue;
+                }
+              double pathGainLinear = std::pow (10.0, (-pathLossDb) / 10.0);
+              Ptr<SpectrumValue> rxPsd = Copy<SpectrumValue> (txPsds[i]);
+              *rxPsd *= pathGainLinear;
+              if (spectrumPropagationLoss)
+                {
+                  rxPsd = spectrumPropagationLoss->CalcRxPowerSpectralDensity (rxPsd, txMobilities[i], rxMobility);
+                }
+              double power = (m_rbId >= 0) ? (*rxPsd)[m_rbId] * 180000 : Integral (*rxPsd);
+
+              sumPower += power;
+              if (power > referenceSignalPower)
+                {
+                  referenceSignalPower = power;
+                }
+            }
+
+          double sinr = referenceSignalPower / (sumPower - referenceSignalPower + m_noisePower);
+          m_outFile << x << "\t"
+                    << y << "\t"
+                    << m_z << "\t"
+                    << sinr
+                    << "\n";
+        }
+    }
+
+  m_capturedTx.clear ();
+  Finalize ();
+}
+
 } // namespace ns3
@@ -25,6 +25,7 @@
 
 #include <ns3/object.h>
 #include <fstream>
+#include <vector>
 
 
 namespace ns3 {
@@ -35,6 +36,7 @@ class NetDevice;
 class SpectrumChannel;
 //class BuildingsMobilityModel;
 class MobilityModel;
+class SpectrumSignalParameters;
 
 /** 
  * \ingroup lte
@@ -42,6 +44,15 @@ class MobilityModel;
  * Generates a 2D map of the SINR from the strongest transmitter in the
  * downlink of an LTE FDD system. For instructions on usage, please refer to
  * the User Documentation.
+ *
+ * By default, the map is generated by attaching SINR listeners to the
+ * channel and letting them receive the actual transmissions. If the
+ * `Offline` attribute is true, the downlink transmissions of a single
+ * subframe are captured from the channel instead, and the SINR of every
+ * point of the map is computed directly from them, using the antenna and
+ * propagation models of the channel. This is much faster and needs no
+ * listeners, but it assumes that the transmissions do not change over the
+ * time needed to generate the map.
  */
 class RadioEnvironmentMapHelper : public Object
 {
@@ -108,6 +119,28 @@ private:
   /// Called when the map generation procedure has been completed.
   void Finalize ();
 
+  /**
+   * Scheduled by Install() in place of DelayedInstall() when the `Offline`
+   * attribute is true, with the timing of the first RunOneIteration(). Starts
+   * capturing the transmissions on the channel, and schedules a call to
+   * RunOffline() in 0.5 milliseconds.
+   */
+  void StartCapture ();
+
+  /**
+   * Store a downlink transmission captured on the channel.
+   *
+   * \param params the parameters of the transmitted signal
+   */
+  void CaptureTransmission (Ptr<SpectrumSignalParameters> params);
+
+  /**
+   * Stop capturing the transmissions, compute the SINR of every point of
+   * the map from the captured transmissions and write it to the output
+   * file. Afterwards, call Finalize().
+   */
+  void RunOffline ();
+
   /// A complete Radio Environment Map is composed of many of this structure.
   struct RemPoint 
   {
@@ -152,6 +185,11 @@ private:
   bool m_useDataChannel;  ///< The `UseDataChannel` attribute.
   int32_t m_rbId;         ///< The `RbId` attribute.
 
+  bool m_offline;  ///< The `Offline` attribute.
+
+  /// Downlink transmissions captured on the channel by the offline generation.
+  std::vector<Ptr<SpectrumSignalParameters> > m_capturedTx;
+
 }; // end of `class RadioEnvironmentMapHelper`
 
 
@@ -26,8 +26,10 @@
 #include "ns3/ipv4.h"
 #include "ns3/inet-socket-address.h"
 #include "ns3/uinteger.h"
+#include "ns3/boolean.h"
 
 #include "epc-gtpu-header.h"
+#include "epc-gtpu-tag.h"
 #include "eps-bearer-tag.h"
 
 
@@ -72,6 +74,14 @@ EpcEnbApplication::GetTypeId (void)
                      "Receive data packets from S1-U Net Device",
                      MakeTraceSourceAccessor (&EpcEnbApplication::m_rxS1uSocketPktTrace),
                      "ns3::EpcEnbApplication::RxTracedCallback")
+    .AddAttribute ("GtpuFastPath",
+                   "If true, GTP-U packets are tunneled with a GtpuTag and padding bytes "
+                   "instead of a GtpuHeader, which avoids the serialization of the header. "
+                   "The size of the tunneled packets is unchanged, but their payload is not "
+                   "a valid GTP-U packet, hence this must not be used with real network devices.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&EpcEnbApplication::m_gtpuFastPath),
+                   MakeBooleanChecker ())
     ;
   return tid;
 }
@@ -91,6 +101,7 @@ EpcEnbApplication::EpcEnbApplication (Ptr<Socket> lteSocket, Ptr<Socket> lteSock
   : m_lteSocket (lteSocket),
     m_lteSocket6 (lteSocket6),
     m_gtpuUdpPort (2152), // fixed by the standard
+    m_gtpuFastPath (false),
     m_s1SapUser (0),
     m_s1apSapMme (0),
     m_cellId (cellId)
@@ -302,10 +313,8 @@ EpcEnbApplication::RecvFromS1uSocket (Ptr<Socket> socket)
   NS_LOG_FUNCTION (this << socket);  
   NS_ASSERT (socket == m_s1uSocket);
   Ptr<Packet> packet = socket->Recv ();
-  GtpuHeader gtpu;
-  packet->RemoveHeader (gtpu);
-  uint32_t teid = gtpu.GetTeid ();
-  std::map<uint32_t, EpsFlowId_t>::iterator it = m_teidRbidMap.find (teid);
+  uint32_t teid = GtpuTag::Decapsulate (packet);
+  std::unordered_map<uint32_t, EpsFlowId_t>::iterator it = m_teidRbidMap.find (teid);
   if (it == m_teidRbidMap.end ())
     {
       NS_LOG_WARN ("UE context at cell id " << m_cellId << " not found, discarding packet");
@@ -350,12 +359,19 @@ void
 EpcEnbApplication::SendToS1uSocket (Ptr<Packet> packet, uint32_t teid)
 {
   NS_LOG_FUNCTION (this << packet << teid <<  packet->GetSize ());  
-  GtpuHeader gtpu;
-  gtpu.SetTeid (teid);
-  // From 3GPP TS 29.281 v10.0.0 Section 5.1
-  // Length of the payload + the non obligatory GTP-U header
-  gtpu.SetLength (packet->GetSize () + gtpu.GetSerializedSize () - 8);  
-  packet->AddHeader (gtpu);
+  if (m_gtpuFastPath)
+    {
+      GtpuTag::Encapsulate (packet, teid);
+    }
+  else
+    {
+      GtpuHeader gtpu;
+      gtpu.SetTeid (teid);
+      // From 3GPP TS 29.281 v10.0.0 Section 5.1
+      // Length of the payload + the non obligatory GTP-U header
+      gtpu.SetLength (packet->GetSize () + gtpu.GetSerializedSize () - 8);
+      packet->AddHeader (gtpu);
+    }
   uint32_t flags = 0;
   m_s1uSocket->SendTo (packet, flags, InetSocketAddress (m_sgwS1uAddress, m_gtpuUdpPort));
 }
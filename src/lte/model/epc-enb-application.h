@@ -35,6 +35,7 @@
 #include <ns3/epc-enb-s1-sap.h>
 #include <ns3/epc-s1ap-sap.h>
 #include <map>
+#include <unordered_map>
 
 namespace ns3 {
 class EpcEnbS1SapUser;
@@ -290,13 +291,18 @@ private:
    * map telling for each S1-U TEID the corresponding RNTI,BID
    * 
    */
-  std::map<uint32_t, EpsFlowId_t> m_teidRbidMap;
+  std::unordered_map<uint32_t, EpsFlowId_t> m_teidRbidMap;
  
   /**
    * UDP port to be used for GTP
    */
   uint16_t m_gtpuUdpPort;
 
+  /**
+   * Whether GTP-U packets are sent with a GtpuTag instead of a GtpuHeader
+   */
+  bool m_gtpuFastPath;
+
   /**
    * Provider for the S1 SAP 
    */
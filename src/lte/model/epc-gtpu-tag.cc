@@ -0,0 +1,113 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "epc-gtpu-tag.h"
+#include "epc-gtpu-header.h"
+#include "ns3/uinteger.h"
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (GtpuTag);
+
+TypeId
+GtpuTag::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::GtpuTag")
+    .SetParent<Tag> ()
+    .SetGroupName ("Lte")
+    .AddConstructor<GtpuTag> ()
+    .AddAttribute ("teid", "The TEID of the GTP-U tunnel carrying the packet",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&GtpuTag::GetTeid),
+                   MakeUintegerChecker<uint32_t> ())
+  ;
+  return tid;
+}
+
+TypeId
+GtpuTag::GetInstanceTypeId (void) const
+{
+  return GetTypeId ();
+}
+
+GtpuTag::GtpuTag ()
+  : m_teid (0)
+{
+}
+
+GtpuTag::GtpuTag (uint32_t teid)
+  : m_teid (teid)
+{
+}
+
+void
+GtpuTag::SetTeid (uint32_t teid)
+{
+  m_teid = teid;
+}
+
+uint32_t
+GtpuTag::GetTeid (void) const
+{
+  return m_teid;
+}
+
+uint32_t
+GtpuTag::GetSerializedSize (void) const
+{
+  return 4;
+}
+
+void
+GtpuTag::Serialize (TagBuffer i) const
+{
+  i.WriteU32 (m_teid);
+}
+
+void
+GtpuTag::Deserialize (TagBuffer i)
+{
+  m_teid = i.ReadU32 ();
+}
+
+void
+GtpuTag::Print (std::ostream &os) const
+{
+  os << "teid=" << m_teid;
+}
+
+void
+GtpuTag::Encapsulate (Ptr<Packet> packet, uint32_t teid)
+{
+  packet->AddPaddingAtEnd (GtpuHeader ().GetSerializedSize ());
+  packet->AddPacketTag (GtpuTag (teid));
+}
+
+uint32_t
+GtpuTag::Decapsulate (Ptr<Packet> packet)
+{
+  GtpuTag tag;
+  if (packet->RemovePacketTag (tag))
+    {
+      packet->RemoveAtEnd (GtpuHeader ().GetSerializedSize ());
+      return tag.GetTeid ();
+    }
+  GtpuHeader gtpu;
+  packet->RemoveHeader (gtpu);
+  return gtpu.GetTeid ();
+}
+
+} // namespace ns3
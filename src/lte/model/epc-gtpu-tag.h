@@ -0,0 +1,101 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EPC_GTPU_TAG_H
+#define EPC_GTPU_TAG_H
+
+#include "ns3/tag.h"
+#include "ns3/packet.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup lte
+ *
+ * Tag used instead of a GtpuHeader to carry the TEID of a GTP-U tunnel
+ * between the EPC entities when the GTP-U fast path is enabled.
+ *
+ * The sender of a tunneled packet adds the tag and as many padding bytes
+ * as the size of the GtpuHeader, so that the size of the packet seen by
+ * the links and by the traces of the backhaul is the same as with a real
+ * GTP-U header; the receiver removes both.
+ */
+class GtpuTag : public Tag
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+  virtual TypeId GetInstanceTypeId (void) const;
+
+  /**
+   * Create an empty GtpuTag
+   */
+  GtpuTag ();
+
+  /**
+   * Create a GtpuTag with the given TEID
+   *
+   * \param teid the value of the TEID to set
+   */
+  GtpuTag (uint32_t teid);
+
+  /**
+   * Set the TEID to the given value.
+   *
+   * \param teid the value of the TEID to set
+   */
+  void SetTeid (uint32_t teid);
+
+  /**
+   * Get TEID function
+   * \returns the TEID
+   */
+  uint32_t GetTeid (void) const;
+
+  virtual void Serialize (TagBuffer i) const;
+  virtual void Deserialize (TagBuffer i);
+  virtual uint32_t GetSerializedSize () const;
+  virtual void Print (std::ostream &os) const;
+
+  /**
+   * Encapsulate a packet without building a GtpuHeader: add a GtpuTag
+   * and as many padding bytes as a GtpuHeader would take.
+   *
+   * \param packet the packet to encapsulate
+   * \param teid the TEID of the tunnel
+   */
+  static void Encapsulate (Ptr<Packet> packet, uint32_t teid);
+
+  /**
+   * Decapsulate a packet encapsulated either with Encapsulate or
+   * with a GtpuHeader.
+   *
+   * \param packet the packet to decapsulate
+   * \returns the TEID of the tunnel
+   */
+  static uint32_t Decapsulate (Ptr<Packet> packet);
+
+private:
+  uint32_t m_teid; ///< TEID value
+};
+
+
+} // namespace ns3
+
+#endif /* EPC_GTPU_TAG_H */
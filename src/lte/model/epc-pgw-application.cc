@@ -28,7 +28,9 @@
 #include "ns3/ipv6-header.h"
 #include "ns3/ipv6-l3-protocol.h"
 #include "ns3/inet-socket-address.h"
+#include "ns3/boolean.h"
 #include "ns3/epc-gtpu-header.h"
+#include "ns3/epc-gtpu-tag.h"
 #include "ns3/epc-pgw-application.h"
 
 namespace ns3 {
@@ -126,6 +128,14 @@ EpcPgwApplication::GetTypeId (void)
                      "Receive data packets from S5 Socket",
                      MakeTraceSourceAccessor (&EpcPgwApplication::m_rxS5PktTrace),
                      "ns3::EpcPgwApplication::RxTracedCallback")
+    .AddAttribute ("GtpuFastPath",
+                   "If true, GTP-U packets are tunneled with a GtpuTag and padding bytes "
+                   "instead of a GtpuHeader, which avoids the serialization of the header. "
+                   "The size of the tunneled packets is unchanged, but their payload is not "
+                   "a valid GTP-U packet, hence this must not be used with real network devices.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&EpcPgwApplication::m_gtpuFastPath),
+                   MakeBooleanChecker ())
     ;
   return tid;
 }
@@ -147,6 +157,7 @@ EpcPgwApplication::EpcPgwApplication (const Ptr<VirtualNetDevice> tunDevice, Ipv
     m_s5cSocket (s5cSocket),
     m_tunDevice (tunDevice),
     m_gtpuUdpPort (2152), // fixed by the standard
+    m_gtpuFastPath (false),
     m_gtpcUdpPort (2123)  // fixed by the standard
 {
   NS_LOG_FUNCTION (this << tunDevice << s5Addr << s5uSocket << s5cSocket);
@@ -174,7 +185,7 @@ EpcPgwApplication::RecvFromTunDevice (Ptr<Packet> packet, const Address& source,
       NS_LOG_LOGIC ("packet addressed to UE " << ueAddr);
 
       // find corresponding UeInfo address
-      std::map<Ipv4Address, Ptr<UeInfo> >::iterator it = m_ueInfoByAddrMap.find (ueAddr);
+      std::unordered_map<Ipv4Address, Ptr<UeInfo>, Ipv4AddressHash>::iterator it = m_ueInfoByAddrMap.find (ueAddr);
       if (it == m_ueInfoByAddrMap.end ())
         {
           NS_LOG_WARN ("unknown UE address " << ueAddr);
@@ -201,7 +212,7 @@ EpcPgwApplication::RecvFromTunDevice (Ptr<Packet> packet, const Address& source,
       NS_LOG_LOGIC ("packet addressed to UE " << ueAddr);
 
       // find corresponding UeInfo address
-      std::map<Ipv6Address, Ptr<UeInfo> >::iterator it = m_ueInfoByAddrMap6.find (ueAddr);
+      std::unordered_map<Ipv6Address, Ptr<UeInfo>, Ipv6AddressHash>::iterator it = m_ueInfoByAddrMap6.find (ueAddr);
       if (it == m_ueInfoByAddrMap6.end ())
         {
           NS_LOG_WARN ("unknown UE address " << ueAddr);
@@ -240,9 +251,7 @@ EpcPgwApplication::RecvFromS5uSocket (Ptr<Socket> socket)
   Ptr<Packet> packet = socket->Recv ();
   m_rxS5PktTrace (packet->Copy ());
 
-  GtpuHeader gtpu;
-  packet->RemoveHeader (gtpu);
-  uint32_t teid = gtpu.GetTeid ();
+  uint32_t teid = GtpuTag::Decapsulate (packet);
 
   SendToTunDevice (packet, teid);
 }
@@ -461,12 +470,19 @@ EpcPgwApplication::SendToS5uSocket (Ptr<Packet> packet, Ipv4Address sgwAddr, uin
 {
   NS_LOG_FUNCTION (this << packet << sgwAddr << teid);
 
-  GtpuHeader gtpu;
-  gtpu.SetTeid (teid);
-  // From 3GPP TS 29.281 v10.0.0 Section 5.1
-  // Length of the payload + the non obligatory GTP-U header
-  gtpu.SetLength (packet->GetSize () + gtpu.GetSerializedSize () - 8);
-  packet->AddHeader (gtpu);
+  if (m_gtpuFastPath)
+    {
+      GtpuTag::Encapsulate (packet, teid);
+    }
+  else
+    {
+      GtpuHeader gtpu;
+      gtpu.SetTeid (teid);
+      // From 3GPP TS 29.281 v10.0.0 Section 5.1
+      // Length of the payload + the non obligatory GTP-U header
+      gtpu.SetLength (packet->GetSize () + gtpu.GetSerializedSize () - 8);
+      packet->AddHeader (gtpu);
+    }
   uint32_t flags = 0;
   m_s5uSocket->SendTo (packet, flags, InetSocketAddress (sgwAddr, m_gtpuUdpPort));
 }
@@ -27,6 +27,10 @@
 #include "ns3/application.h"
 #include "ns3/epc-tft-classifier.h"
 #include "ns3/epc-gtpc-header.h"
+#include "ns3/ipv4-address.h"
+#include "ns3/ipv6-address.h"
+
+#include <unordered_map>
 
 namespace ns3 {
 
@@ -300,12 +304,12 @@ private:
   /**
    * UeInfo stored by UE IPv4 address
    */
-  std::map<Ipv4Address, Ptr<UeInfo> > m_ueInfoByAddrMap;
+  std::unordered_map<Ipv4Address, Ptr<UeInfo>, Ipv4AddressHash> m_ueInfoByAddrMap;
 
   /**
    * UeInfo stored by UE IPv6 address
    */
-  std::map<Ipv6Address, Ptr<UeInfo> > m_ueInfoByAddrMap6;
+  std::unordered_map<Ipv6Address, Ptr<UeInfo>, Ipv6AddressHash> m_ueInfoByAddrMap6;
 
   /**
    * UeInfo stored by IMSI
@@ -317,6 +321,11 @@ private:
    */
   uint16_t m_gtpuUdpPort;
 
+  /**
+   * Whether GTP-U packets are sent with a GtpuTag instead of a GtpuHeader
+   */
+  bool m_gtpuFastPath;
+
   /**
    * UDP port to be used for GTPv2-C
    */
@@ -19,7 +19,9 @@
  */
 
 #include "ns3/log.h"
+#include "ns3/boolean.h"
 #include "ns3/epc-gtpu-header.h"
+#include "ns3/epc-gtpu-tag.h"
 #include "ns3/epc-sgw-application.h"
 
 namespace ns3 {
@@ -35,6 +37,7 @@ EpcSgwApplication::EpcSgwApplication (const Ptr<Socket> s1uSocket, Ipv4Address s
     m_s5cSocket (s5cSocket),
     m_s1uSocket (s1uSocket),
     m_gtpuUdpPort (2152), // fixed by the standard
+    m_gtpuFastPath (false),
     m_gtpcUdpPort (2123), // fixed by the standard
     m_teidCount (0)
 {
@@ -66,7 +69,16 @@ EpcSgwApplication::GetTypeId (void)
 {
   static TypeId tid = TypeId ("ns3::EpcSgwApplication")
     .SetParent<Object> ()
-    .SetGroupName("Lte");
+    .SetGroupName("Lte")
+    .AddAttribute ("GtpuFastPath",
+                   "If true, GTP-U packets are tunneled with a GtpuTag and padding bytes "
+                   "instead of a GtpuHeader, which avoids the serialization of the header. "
+                   "The size of the tunneled packets is unchanged, but their payload is not "
+                   "a valid GTP-U packet, hence this must not be used with real network devices.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&EpcSgwApplication::m_gtpuFastPath),
+                   MakeBooleanChecker ())
+    ;
   return tid;
 }
 
@@ -139,9 +151,7 @@ EpcSgwApplication::RecvFromS5uSocket (Ptr<Socket> socket)
   NS_LOG_FUNCTION (this << socket);
   NS_ASSERT (socket == m_s5uSocket);
   Ptr<Packet> packet = socket->Recv ();
-  GtpuHeader gtpu;
-  packet->RemoveHeader (gtpu);
-  uint32_t teid = gtpu.GetTeid ();
+  uint32_t teid = GtpuTag::Decapsulate (packet);
 
   Ipv4Address enbAddr = m_enbByTeidMap[teid];
   NS_LOG_DEBUG ("eNB " << enbAddr << " TEID " << teid);
@@ -184,9 +194,7 @@ EpcSgwApplication::RecvFromS1uSocket (Ptr<Socket> socket)
   NS_LOG_FUNCTION (this << socket);
   NS_ASSERT (socket == m_s1uSocket);
   Ptr<Packet> packet = socket->Recv ();
-  GtpuHeader gtpu;
-  packet->RemoveHeader (gtpu);
-  uint32_t teid = gtpu.GetTeid ();
+  uint32_t teid = GtpuTag::Decapsulate (packet);
 
   SendToS5uSocket (packet, m_pgwAddr, teid);
 }
@@ -196,12 +204,19 @@ EpcSgwApplication::SendToS1uSocket (Ptr<Packet> packet, Ipv4Address enbAddr, uin
 {
   NS_LOG_FUNCTION (this << packet << enbAddr << teid);
 
-  GtpuHeader gtpu;
-  gtpu.SetTeid (teid);
-  // From 3GPP TS 29.281 v10.0.0 Section 5.1
-  // Length of the payload + the non obligatory GTP-U header
-  gtpu.SetLength (packet->GetSize () + gtpu.GetSerializedSize () - 8);
-  packet->AddHeader (gtpu);
+  if (m_gtpuFastPath)
+    {
+      GtpuTag::Encapsulate (packet, teid);
+    }
+  else
+    {
+      GtpuHeader gtpu;
+      gtpu.SetTeid (teid);
+      // From 3GPP TS 29.281 v10.0.0 Section 5.1
+      // Length of the payload + the non obligatory GTP-U header
+      gtpu.SetLength (packet->GetSize () + gtpu.GetSerializedSize () - 8);
+      packet->AddHeader (gtpu);
+    }
   m_s1uSocket->SendTo (packet, 0, InetSocketAddress (enbAddr, m_gtpuUdpPort));
 }
 
@@ -210,12 +225,19 @@ EpcSgwApplication::SendToS5uSocket (Ptr<Packet> packet, Ipv4Address pgwAddr, uin
 {
   NS_LOG_FUNCTION (this << packet << pgwAddr << teid);
 
-  GtpuHeader gtpu;
-  gtpu.SetTeid (teid);
-  // From 3GPP TS 29.281 v10.0.0 Section 5.1
-  // Length of the payload + the non obligatory GTP-U header
-  gtpu.SetLength (packet->GetSize () + gtpu.GetSerializedSize () - 8);
-  packet->AddHeader (gtpu);
+  if (m_gtpuFastPath)
+    {
+      GtpuTag::Encapsulate (packet, teid);
+    }
+  else
+    {
+      GtpuHeader gtpu;
+      gtpu.SetTeid (teid);
+      // From 3GPP TS 29.281 v10.0.0 Section 5.1
+      // Length of the payload + the non obligatory GTP-U header
+      gtpu.SetLength (packet->GetSize () + gtpu.GetSerializedSize () - 8);
+      packet->AddHeader (gtpu);
+    }
   m_s5uSocket->SendTo (packet, 0, InetSocketAddress (pgwAddr, m_gtpuUdpPort));
 }
 
@@ -323,7 +345,7 @@ EpcSgwApplication::DoRecvModifyBearerRequest (Ptr<Packet> packet)
       Ipv4Address enbAddr = bearerContext.fteid.addr;
       NS_LOG_DEBUG ("bearerId " << (uint16_t)bearerContext.epsBearerId <<
                     " TEID " << teid);
-      std::map<uint32_t, Ipv4Address>::iterator addrit = m_enbByTeidMap.find (teid);
+      std::unordered_map<uint32_t, Ipv4Address>::iterator addrit = m_enbByTeidMap.find (teid);
       NS_ASSERT_MSG (addrit != m_enbByTeidMap.end (), "unknown TEID " << teid);
       addrit->second = enbAddr;
       GtpcModifyBearerRequestMessage::BearerContextToBeModified bearerContextOut;
@@ -26,6 +26,8 @@
 #include "ns3/socket.h"
 #include "ns3/epc-gtpc-header.h"
 
+#include <unordered_map>
+
 namespace ns3 {
 
 /**
@@ -238,6 +240,11 @@ private:
    */
   uint16_t m_gtpuUdpPort;
 
+  /**
+   * Whether GTP-U packets are sent with a GtpuTag instead of a GtpuHeader
+   */
+  bool m_gtpuFastPath;
+
   /**
    * UDP port to be used for GTP-C
    */
@@ -264,7 +271,7 @@ private:
   /**
    * Map for eNB address by TEID
    */
-  std::map<uint32_t, Ipv4Address> m_enbByTeidMap;
+  std::unordered_map<uint32_t, Ipv4Address> m_enbByTeidMap;
 
   /**
    * MME S11 FTEID by SGW S5C TEID
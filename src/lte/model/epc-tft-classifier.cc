@@ -42,6 +42,9 @@ namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("EpcTftClassifier");
 
+/// Maximum number of flows kept in each classification cache; the cache is flushed when exceeded
+static const uint32_t MAX_CACHED_FLOWS = 4096;
+
 EpcTftClassifier::EpcTftClassifier ()
 {
   NS_LOG_FUNCTION (this);
@@ -52,6 +55,7 @@ EpcTftClassifier::Add (Ptr<EpcTft> tft, uint32_t id)
 {
   NS_LOG_FUNCTION (this << tft << id);
   m_tftMap[id] = tft;
+  ClearFlowCache ();
 
   // simple sanity check: there shouldn't be more than 16 bearers (hence TFTs) per UE
   NS_ASSERT (m_tftMap.size () <= 16);
@@ -62,6 +66,15 @@ EpcTftClassifier::Delete (uint32_t id)
 {
   NS_LOG_FUNCTION (this << id);
   m_tftMap.erase (id);
+  ClearFlowCache ();
+}
+
+void
+EpcTftClassifier::ClearFlowCache ()
+{
+  NS_LOG_FUNCTION (this);
+  m_ipv4FlowCache.clear ();
+  m_ipv6FlowCache.clear ();
 }
 
 uint32_t 
@@ -267,6 +280,21 @@ EpcTftClassifier::Classify (Ptr<Packet> p, EpcTft::Direction direction, uint16_t
           << " remotePort=" << remotePort
           << " tos=0x" << (uint16_t) tos );
 
+      // packets of a flow that was already classified get the same TFT
+      Ipv4FlowKey_t flowKey = std::make_tuple (static_cast<uint8_t> (direction),
+                                               remoteAddressIpv4.Get (), localAddressIpv4.Get (),
+                                               remotePort, localPort, tos);
+      std::map<Ipv4FlowKey_t, uint32_t>::const_iterator cacheIt = m_ipv4FlowCache.find (flowKey);
+      if (cacheIt != m_ipv4FlowCache.end ())
+        {
+          NS_LOG_LOGIC ("flow already classified with TFT ID = " << cacheIt->second);
+          return cacheIt->second;
+        }
+      if (m_ipv4FlowCache.size () >= MAX_CACHED_FLOWS)
+        {
+          m_ipv4FlowCache.clear ();
+        }
+
       // now it is possible to classify the packet!
       // we use a reverse iterator since filter priority is not implemented properly.
       // This way, since the default bearer is expected to be added first, it will be evaluated last.
@@ -281,9 +309,11 @@ EpcTftClassifier::Classify (Ptr<Packet> p, EpcTft::Direction direction, uint16_t
           if (tft->Matches (direction, remoteAddressIpv4, localAddressIpv4, remotePort, localPort, tos))
             {
               NS_LOG_LOGIC ("matches with TFT ID = " << it->first);
+              m_ipv4FlowCache[flowKey] = it->first;
               return it->first; // the id of the matching TFT
             }
         }
+      m_ipv4FlowCache[flowKey] = 0;
     }
   else if (protocolNumber == Ipv6L3Protocol::PROT_NUMBER)
     {
@@ -294,6 +324,21 @@ EpcTftClassifier::Classify (Ptr<Packet> p, EpcTft::Direction direction, uint16_t
           << " remotePort=" << remotePort
           << " tos=0x" << (uint16_t) tos );
 
+      // packets of a flow that was already classified get the same TFT
+      Ipv6FlowKey_t flowKey = std::make_tuple (static_cast<uint8_t> (direction),
+                                               remoteAddressIpv6, localAddressIpv6,
+                                               remotePort, localPort, tos);
+      std::map<Ipv6FlowKey_t, uint32_t>::const_iterator cacheIt = m_ipv6FlowCache.find (flowKey);
+      if (cacheIt != m_ipv6FlowCache.end ())
+        {
+          NS_LOG_LOGIC ("flow already classified with TFT ID = " << cacheIt->second);
+          return cacheIt->second;
+        }
+      if (m_ipv6FlowCache.size () >= MAX_CACHED_FLOWS)
+        {
+          m_ipv6FlowCache.clear ();
+        }
+
       // now it is possible to classify the packet!
       // we use a reverse iterator since filter priority is not implemented properly.
       // This way, since the default bearer is expected to be added first, it will be evaluated last.
@@ -308,9 +353,11 @@ EpcTftClassifier::Classify (Ptr<Packet> p, EpcTft::Direction direction, uint16_t
           if (tft->Matches (direction, remoteAddressIpv6, localAddressIpv6, remotePort, localPort, tos))
             {
               NS_LOG_LOGIC ("matches with TFT ID = " << it->first);
+              m_ipv6FlowCache[flowKey] = it->first;
               return it->first; // the id of the matching TFT
             }
         }
+      m_ipv6FlowCache[flowKey] = 0;
     }
   NS_LOG_LOGIC ("no match");
   return 0;  // no match
@@ -26,8 +26,10 @@
 #include "ns3/ptr.h"
 #include "ns3/simple-ref-count.h"
 #include "ns3/epc-tft.h"
+#include "ns3/ipv6-address.h"
 
 #include <map>
+#include <tuple>
 
 
 namespace ns3 {
@@ -50,6 +52,12 @@ class Packet;
  *
  * When we cannot cache the port info, the TFT of the default bearer is used. This may happen
  * if there is reordering or losses of IP packets.
+ *
+ * The result of the TFT matching is cached per flow, i.e. per (direction, remote address,
+ * local address, remote port, local port, ToS) tuple, so that only the first packet of a
+ * flow is matched against the packet filters of every TFT. The cache is flushed whenever
+ * a TFT is added or deleted; a TFT must therefore not be modified after having been added
+ * to the classifier.
  */
 class EpcTftClassifier : public SimpleRefCount<EpcTftClassifier>
 {
@@ -98,6 +106,20 @@ protected:
                                  ///<   not first fragment or not enough payload data for TCP/UDP
                                  ///< An entry is removed when the last fragment is classified
                                  ///<   Note: If last fragment is lost, entry is not removed
+
+private:
+  /**
+   * Flush the per-flow classification cache
+   */
+  void ClearFlowCache ();
+
+  /// Key of an IPv4 flow: direction, remote address, local address, remote port, local port, ToS
+  typedef std::tuple<uint8_t, uint32_t, uint32_t, uint16_t, uint16_t, uint8_t> Ipv4FlowKey_t;
+  /// Key of an IPv6 flow: direction, remote address, local address, remote port, local port, ToS
+  typedef std::tuple<uint8_t, Ipv6Address, Ipv6Address, uint16_t, uint16_t, uint8_t> Ipv6FlowKey_t;
+
+  std::map<Ipv4FlowKey_t, uint32_t> m_ipv4FlowCache; ///< TFT id (0 if none) already selected for each IPv4 flow
+  std::map<Ipv6FlowKey_t, uint32_t> m_ipv6FlowCache; ///< TFT id (0 if none) already selected for each IPv6 flow
 };
 
 
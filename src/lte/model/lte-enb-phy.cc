@@ -309,6 +309,7 @@ LteEnbPhy::SetTxPower (double pow)
 {
   NS_LOG_FUNCTION (this << pow);
   m_txPower = pow;
+  m_dlCtrlTxPsd = 0;
 }
 
 double
@@ -648,6 +649,7 @@ LteEnbPhy::StartSubFrame (void)
           // send info of TB to LteSpectrumPhy
           // translate to allocation map
           std::vector <int> rbMap;
+          rbMap.reserve ((*dciIt).GetDci ().m_rbLen);
           for (int i = (*dciIt).GetDci ().m_rbStart; i < (*dciIt).GetDci ().m_rbStart + (*dciIt).GetDci ().m_rbLen; i++)
             {
               rbMap.push_back (i);
@@ -775,11 +777,17 @@ LteEnbPhy::SendControlChannels (std::list<Ptr<LteControlMessage> > ctrlMsgList)
   NS_LOG_FUNCTION (this << " eNB " << m_cellId << " start tx ctrl frame");
   // set the current tx power spectral density (full bandwidth)
   std::vector <int> dlRb;
+  dlRb.reserve (m_dlBandwidth);
   for (uint8_t i = 0; i < m_dlBandwidth; i++)
     {
       dlRb.push_back (i);
     }
-  SetDownlinkSubChannels (dlRb);
+  m_listOfDownlinkSubchannel.swap (dlRb);
+  if (m_dlCtrlTxPsd == 0)
+    {
+      m_dlCtrlTxPsd = CreateTxPowerSpectralDensity ();
+    }
+  m_downlinkSpectrumPhy->SetTxPowerSpectralDensity (m_dlCtrlTxPsd);
   NS_LOG_LOGIC (this << " eNB start TX CTRL");
   bool pss = false;
   if ((m_nrSubFrames == 1) || (m_nrSubFrames == 6))
@@ -895,6 +903,7 @@ LteEnbPhy::DoSetBandwidth (uint16_t ulBandwidth, uint16_t dlBandwidth)
   NS_LOG_FUNCTION (this << (uint32_t) ulBandwidth << (uint32_t) dlBandwidth);
   m_ulBandwidth = ulBandwidth;
   m_dlBandwidth = dlBandwidth;
+  m_dlCtrlTxPsd = 0;
 
   static const int Type0AllocationRbg[4] = {
     10,     // RGB size 1
@@ -918,6 +927,7 @@ LteEnbPhy::DoSetEarfcn (uint32_t ulEarfcn, uint32_t dlEarfcn)
   NS_LOG_FUNCTION (this << ulEarfcn << dlEarfcn);
   m_ulEarfcn = ulEarfcn;
   m_dlEarfcn = dlEarfcn;
+  m_dlCtrlTxPsd = 0;
 }
 
 
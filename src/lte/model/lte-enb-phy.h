@@ -442,6 +442,13 @@ private:
 
   std::vector <int> m_dlDataRbMap; ///< DL data RB map
 
+  /**
+   * Tx PSD of the DL control frame, which always spans the full bandwidth.
+   * Built on the first use and reset when the Tx power, the bandwidth or
+   * the EARFCN change, so that it is not rebuilt at every subframe.
+   */
+  Ptr<SpectrumValue> m_dlCtrlTxPsd;
+
   /// For storing info on future receptions.
   std::vector< std::list<UlDciLteControlMessage> > m_ulDciQueue;
 
@@ -27,6 +27,8 @@
 #include "ns3/lte-rlc-sdu-status-tag.h"
 #include "ns3/lte-rlc-tag.h"
 
+#include <bitset>
+
 
 namespace ns3 {
 
@@ -447,7 +449,7 @@ LteRlcAm::DoNotifyTxOpportunity (LteMacSapUser::TxOpportunityParameters txOpPara
   Ptr<Packet> firstSegment = m_txonBuffer.begin ()->m_pdu->Copy ();
   m_txonBufferSize -= m_txonBuffer.begin ()->m_pdu->GetSize ();
   NS_LOG_LOGIC ("txBufferSize      = " << m_txonBufferSize );
-  m_txonBuffer.erase (m_txonBuffer.begin ());
+  m_txonBuffer.pop_front ();
 
   while ( firstSegment && (firstSegment->GetSize () > 0) && (nextSegmentSize > 0) )
     {
@@ -495,7 +497,7 @@ LteRlcAm::DoNotifyTxOpportunity (LteMacSapUser::TxOpportunityParameters txOpPara
             {
               firstSegment->AddPacketTag (oldTag);
 
-              m_txonBuffer.insert (m_txonBuffer.begin (), TxPdu (firstSegment, firstSegmentTime));
+              m_txonBuffer.push_front (TxPdu (firstSegment, firstSegmentTime));
               m_txonBufferSize += m_txonBuffer.begin ()->m_pdu->GetSize ();
 
               NS_LOG_LOGIC ("    Txon buffer: Give back the remaining segment");
@@ -602,7 +604,7 @@ LteRlcAm::DoNotifyTxOpportunity (LteMacSapUser::TxOpportunityParameters txOpPara
           firstSegment = m_txonBuffer.begin ()->m_pdu->Copy ();
           firstSegmentTime = m_txonBuffer.begin ()->m_waitingSince;
           m_txonBufferSize -= m_txonBuffer.begin ()->m_pdu->GetSize ();
-          m_txonBuffer.erase (m_txonBuffer.begin ());
+          m_txonBuffer.pop_front ();
           NS_LOG_LOGIC ("        txBufferSize = " << m_txonBufferSize );
         }
 
@@ -1033,6 +1035,13 @@ LteRlcAm::DoReceivePdu (LteMacSapUser::ReceivePduParameters rxPduParams)
 
       bool incrementVtA = true; 
 
+      // index the NACKed SNs, to avoid searching the NACK list for every SN
+      std::bitset<1024> nackedSn;
+      for (int nack = rlcAmHeader.PopNack (); nack >= 0; nack = rlcAmHeader.PopNack ())
+        {
+          nackedSn.set (nack);
+        }
+
       for (sn = m_vtA; sn < ackSn && sn < m_vtS; sn++)
         {
           NS_LOG_LOGIC ("sn = " << sn);
@@ -1045,7 +1054,7 @@ LteRlcAm::DoReceivePdu (LteMacSapUser::ReceivePduParameters rxPduParams)
               m_pollRetransmitTimer.Cancel ();
             }
 
-          if (rlcAmHeader.IsNackPresent (sn))
+          if (nackedSn.test (seqNumberValue))
             {
               NS_LOG_LOGIC ("sn " << sn << " is NACKed");
 
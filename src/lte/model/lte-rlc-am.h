@@ -26,6 +26,7 @@
 #include <ns3/lte-rlc.h>
 
 #include <vector>
+#include <deque>
 #include <map>
 
 namespace ns3 {
@@ -128,7 +129,7 @@ private:
     Time        m_waitingSince;  ///< Layer arrival time
   };
 
-  std::vector < TxPdu > m_txonBuffer; ///< Transmission buffer
+  std::deque < TxPdu > m_txonBuffer; ///< Transmission buffer
 
   /// RetxPdu structure
   struct RetxPdu
@@ -132,7 +132,7 @@ LteRlcTm::DoNotifyTxOpportunity (LteMacSapUser::TxOpportunityParameters txOpPara
     }
 
   m_txBufferSize -= packet->GetSize ();
-  m_txBuffer.erase (m_txBuffer.begin ());
+  m_txBuffer.pop_front ();
 
   m_txPdu (m_rnti, m_lcid, packet->GetSize ());
 
@@ -154,6 +154,7 @@ LteUePhy::LteUePhy ()
 
 LteUePhy::LteUePhy (Ptr<LteSpectrumPhy> dlPhy, Ptr<LteSpectrumPhy> ulPhy)
   : LtePhy (dlPhy, ulPhy),
+    m_txPsdPower (0.0),
     m_uePhySapUser (0),
     m_ueCphySapUser (0),
     m_state (CELL_SEARCH),
@@ -510,10 +511,19 @@ LteUePhy::SetSubChannelsForTransmission (std::vector <int> mask)
 {
   NS_LOG_FUNCTION (this);
 
-  m_subChannelsForTransmission = mask;
-
-  Ptr<SpectrumValue> txPsd = CreateTxPowerSpectralDensity ();
-  m_uplinkSpectrumPhy->SetTxPowerSpectralDensity (txPsd);
+  // the allocation and the power of a UE change seldom in steady state,
+  // hence the PSD of the previous subframe can usually be reused
+  if (m_txPsd == 0 || m_txPsdPower != m_txPower || mask != m_subChannelsForTransmission)
+    {
+      m_subChannelsForTransmission = mask;
+      m_txPsd = CreateTxPowerSpectralDensity ();
+      m_txPsdPower = m_txPower;
+    }
+  else
+    {
+      m_reportPowerSpectralDensity (m_rnti, m_txPsd);
+    }
+  m_uplinkSpectrumPhy->SetTxPowerSpectralDensity (m_txPsd);
 }
 
 
@@ -1257,13 +1267,14 @@ LteUePhy::SubframeIndication (uint32_t frameNo, uint32_t subframeNo)
   if (m_ulConfigured)
     {
       // update uplink transmission mask according to previous UL-CQIs
-      std::vector <int> rbMask = m_subChannelsForTransmissionQueue.at (0);
-      SetSubChannelsForTransmission (m_subChannelsForTransmissionQueue.at (0));
+      std::vector <int> rbMask;
+      rbMask.swap (m_subChannelsForTransmissionQueue.at (0));
+      SetSubChannelsForTransmission (rbMask);
 
-      // shift the queue
+      // shift the queue, moving the (now empty) head to the tail
       for (uint8_t i = 1; i < m_macChTtiDelay; i++)
         {
-          m_subChannelsForTransmissionQueue.at (i - 1) = m_subChannelsForTransmissionQueue.at (i);
+          m_subChannelsForTransmissionQueue.at (i - 1).swap (m_subChannelsForTransmissionQueue.at (i));
         }
       m_subChannelsForTransmissionQueue.at (m_macChTtiDelay - 1).clear ();
 
@@ -1478,6 +1489,7 @@ LteUePhy::DoConfigureUplink (uint32_t ulEarfcn, uint16_t ulBandwidth)
   m_ulEarfcn = ulEarfcn;
   m_ulBandwidth = ulBandwidth;
   m_ulConfigured = true;
+  m_txPsd = 0;
 }
 
 void
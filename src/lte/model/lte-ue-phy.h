@@ -652,6 +652,12 @@ private:
 
   /// A list of sub channels to use in TX.
   std::vector <int> m_subChannelsForTransmission;
+  /**
+   * Tx PSD built for #m_subChannelsForTransmission, reused as long as the
+   * sub channels and the Tx power do not change.
+   */
+  Ptr<SpectrumValue> m_txPsd;
+  double m_txPsdPower; ///< Tx power used to build #m_txPsd
   /// A list of sub channels to use in RX.
   std::vector <int> m_subChannelsForReception;
 
@@ -1895,6 +1895,10 @@ LteUeRrc::MeasurementReportTriggering (uint8_t measId)
   bool eventLeavingCondApplicable = false;
   ConcernedCells_t concernedCellsEntry;
   ConcernedCells_t concernedCellsLeaving;
+  // neighbour cells to be removed from the pending time-to-trigger events,
+  // collected during the evaluation and removed in a single pass below
+  ConcernedCells_t cancelledCellsEntry;
+  ConcernedCells_t cancelledCellsLeaving;
 
   switch (reportConfigEutra.eventId)
     {
@@ -2147,7 +2151,7 @@ LteUeRrc::MeasurementReportTriggering (uint8_t measId)
                 }
               else if (reportConfigEutra.timeToTrigger > 0)
                 {
-                  CancelEnteringTrigger (measId, cellId);
+                  cancelledCellsEntry.push_back (cellId);
                 }
 
               // Inequality A3-2 (Leaving condition): Mn + Ofn + Ocn + Hys < Mp + Ofp + Ocp + Off
@@ -2163,7 +2167,7 @@ LteUeRrc::MeasurementReportTriggering (uint8_t measId)
                 }
               else if (reportConfigEutra.timeToTrigger > 0)
                 {
-                  CancelLeavingTrigger (measId, cellId);
+                  cancelledCellsLeaving.push_back (cellId);
                 }
 
               NS_LOG_LOGIC (this << " event A3: neighbor cell " << cellId
@@ -2248,7 +2252,7 @@ LteUeRrc::MeasurementReportTriggering (uint8_t measId)
                 }
               else if (reportConfigEutra.timeToTrigger > 0)
                 {
-                  CancelEnteringTrigger (measId, cellId);
+                  cancelledCellsEntry.push_back (cellId);
                 }
 
               // Inequality A4-2 (Leaving condition): Mn + Ofn + Ocn + Hys < Thresh
@@ -2264,7 +2268,7 @@ LteUeRrc::MeasurementReportTriggering (uint8_t measId)
                 }
               else if (reportConfigEutra.timeToTrigger > 0)
                 {
-                  CancelLeavingTrigger (measId, cellId);
+                  cancelledCellsLeaving.push_back (cellId);
                 }
 
               NS_LOG_LOGIC (this << " event A4: neighbor cell " << cellId
@@ -2366,7 +2370,7 @@ LteUeRrc::MeasurementReportTriggering (uint8_t measId)
                     }
                   else if (reportConfigEutra.timeToTrigger > 0)
                     {
-                      CancelEnteringTrigger (measId, cellId);
+                      cancelledCellsEntry.push_back (cellId);
                     }
 
                   NS_LOG_LOGIC (this << " event A5: neighbor cell " << cellId
@@ -2455,7 +2459,7 @@ LteUeRrc::MeasurementReportTriggering (uint8_t measId)
 
                               if (!leavingCond)
                                 {
-                                  CancelLeavingTrigger (measId, cellId);
+                                  cancelledCellsLeaving.push_back (cellId);
                                 }
 
                               /*
@@ -2556,6 +2560,16 @@ LteUeRrc::MeasurementReportTriggering (uint8_t measId)
   NS_LOG_LOGIC (this << " eventEntryCondApplicable=" << eventEntryCondApplicable
                      << " eventLeavingCondApplicable=" << eventLeavingCondApplicable);
 
+  if (!cancelledCellsEntry.empty ())
+    {
+      CancelEnteringTrigger (measId, cancelledCellsEntry);
+    }
+
+  if (!cancelledCellsLeaving.empty ())
+    {
+      CancelLeavingTrigger (measId, cancelledCellsLeaving);
+    }
+
   if (eventEntryCondApplicable)
     {
       if (reportConfigEutra.timeToTrigger == 0)
@@ -2629,9 +2643,9 @@ LteUeRrc::CancelEnteringTrigger (uint8_t measId)
 }
 
 void
-LteUeRrc::CancelEnteringTrigger (uint8_t measId, uint16_t cellId)
+LteUeRrc::CancelEnteringTrigger (uint8_t measId, const ConcernedCells_t& cells)
 {
-  NS_LOG_FUNCTION (this << (uint16_t) measId << cellId);
+  NS_LOG_FUNCTION (this << (uint16_t) measId << cells.size ());
 
   std::map<uint8_t, std::list<PendingTrigger_t> >::iterator
     it1 = m_enteringTriggerQueue.find (measId);
@@ -2642,14 +2656,10 @@ LteUeRrc::CancelEnteringTrigger (uint8_t measId, uint16_t cellId)
     {
       NS_ASSERT (it2->measId == measId);
 
-      ConcernedCells_t::iterator it3;
-      for (it3 = it2->concernedCells.begin ();
-           it3 != it2->concernedCells.end (); ++it3)
+      ConcernedCells_t::const_iterator it3;
+      for (it3 = cells.begin (); it3 != cells.end (); ++it3)
         {
-          if (*it3 == cellId)
-            {
-              it3 = it2->concernedCells.erase (it3);
-            }
+          it2->concernedCells.remove (*it3);
         }
 
       if (it2->concernedCells.empty ())
@@ -2691,9 +2701,9 @@ LteUeRrc::CancelLeavingTrigger (uint8_t measId)
 }
 
 void
-LteUeRrc::CancelLeavingTrigger (uint8_t measId, uint16_t cellId)
+LteUeRrc::CancelLeavingTrigger (uint8_t measId, const ConcernedCells_t& cells)
 {
-  NS_LOG_FUNCTION (this << (uint16_t) measId << cellId);
+  NS_LOG_FUNCTION (this << (uint16_t) measId << cells.size ());
 
   std::map<uint8_t, std::list<PendingTrigger_t> >::iterator
     it1 = m_leavingTriggerQueue.find (measId);
@@ -2704,14 +2714,10 @@ LteUeRrc::CancelLeavingTrigger (uint8_t measId, uint16_t cellId)
     {
       NS_ASSERT (it2->measId == measId);
 
-      ConcernedCells_t::iterator it3;
-      for (it3 = it2->concernedCells.begin ();
-           it3 != it2->concernedCells.end (); ++it3)
+      ConcernedCells_t::const_iterator it3;
+      for (it3 = cells.begin (); it3 != cells.end (); ++it3)
         {
-          if (*it3 == cellId)
-            {
-              it3 = it2->concernedCells.erase (it3);
-            }
+          it2->concernedCells.remove (*it3);
         }
 
       if (it2->concernedCells.empty ())
@@ -2789,11 +2795,7 @@ LteUeRrc::VarMeasReportListAdd (uint8_t measId, ConcernedCells_t enteringCells)
            * we clean up the time-to-trigger queue. This case might occur when
            * time-to-trigger > 200 ms.
            */
-          for (ConcernedCells_t::const_iterator it = enteringCells.begin ();
-               it != enteringCells.end (); ++it)
-            {
-              CancelEnteringTrigger (measId, *it);
-            }
+          CancelEnteringTrigger (measId, enteringCells);
         }
 
     } // end of if (!enteringTriggerIt->second.empty ())
@@ -2850,11 +2852,7 @@ LteUeRrc::VarMeasReportListErase (uint8_t measId, ConcernedCells_t leavingCells,
            * we clean up the time-to-trigger queue. This case might occur when
            * time-to-trigger > 200 ms.
            */
-          for (ConcernedCells_t::const_iterator it = leavingCells.begin ();
-               it != leavingCells.end (); ++it)
-            {
-              CancelLeavingTrigger (measId, *it);
-            }
+          CancelLeavingTrigger (measId, leavingCells);
         }
 
     } // end of if (!leavingTriggerIt->second.empty ())
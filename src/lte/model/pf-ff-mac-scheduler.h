@@ -324,6 +324,20 @@ private:
   */
   std::map <uint16_t, pfsFlowPerf_t> m_flowStatsUl;
 
+  /// UE that can be allocated new RBGs in the current TTI
+  struct DlCandidate
+  {
+    std::map <uint16_t, pfsFlowPerf_t>::iterator flowStats; ///< DL statistics of the UE
+    const SbMeasResult_s *sbMeasResult; ///< last subband CQIs of the UE, 0 if none
+    int nLayer; ///< number of layers of the transmission mode of the UE
+  };
+
+  /**
+  * UEs that can be allocated new RBGs in the current TTI, computed once
+  * per TTI instead of once per RBG; kept as a member to reuse its storage
+  */
+  std::vector <DlCandidate> m_dlCandidates;
+
 
   /**
   * Map of UE's DL CQI P01 received
@@ -0,0 +1,179 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/double.h"
+#include "ns3/integer.h"
+#include "ns3/uinteger.h"
+#include "ns3/boolean.h"
+#include "ns3/string.h"
+#include "ns3/node-container.h"
+#include "ns3/net-device-container.h"
+#include "ns3/mobility-helper.h"
+#include "ns3/lte-helper.h"
+#include "ns3/spectrum-channel.h"
+#include "ns3/radio-environment-map-helper.h"
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("LteTestRadioEnvironmentMap");
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test that the REM computed in offline mode matches the REM
+ * computed by attaching listeners to the channel, in a scenario with
+ * deterministic propagation.
+ */
+class LteRadioEnvironmentMapOfflineTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor
+   * \param rbId the resource block used for the map, -1 for the whole band
+   */
+  LteRadioEnvironmentMapOfflineTestCase (int32_t rbId);
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * Generate a REM of a scenario with two eNBs
+   * \param offline whether to generate the map in offline mode
+   * \param fileName the output file
+   */
+  void GenerateRem (bool offline, std::string fileName);
+
+  /**
+   * Read the SINR values of a REM output file
+   * \param fileName the output file
+   * \return the (x, y, SINR) values, in the order in which they are written
+   */
+  std::vector<std::vector<double> > ReadRem (std::string fileName);
+
+  int32_t m_rbId; //!< the resource block used for the map
+};
+
+LteRadioEnvironmentMapOfflineTestCase::LteRadioEnvironmentMapOfflineTestCase (int32_t rbId)
+  : TestCase ("REM offline vs online, RbId=" + std::to_string (rbId)),
+    m_rbId (rbId)
+{
+}
+
+void
+LteRadioEnvironmentMapOfflineTestCase::GenerateRem (bool offline, std::string fileName)
+{
+  Ptr<LteHelper> lteHelper = CreateObject<LteHelper> ();
+  lteHelper->SetAttribute ("PathlossModel", StringValue ("ns3::FriisPropagationLossModel"));
+
+  NodeContainer enbNodes;
+  enbNodes.Create (2);
+  Ptr<ListPositionAllocator> positions = CreateObject<ListPositionAllocator> ();
+  positions->Add (Vector (0.0, 0.0, 10.0));
+  positions->Add (Vector (300.0, 50.0, 10.0));
+  MobilityHelper mobility;
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.SetPositionAllocator (positions);
+  mobility.Install (enbNodes);
+
+  NetDeviceContainer enbDevs = lteHelper->InstallEnbDevice (enbNodes);
+
+  std::ostringstream channelPath;
+  channelPath << "/ChannelList/" << lteHelper->GetDownlinkSpectrumChannel ()->GetId ();
+
+  Ptr<RadioEnvironmentMapHelper> remHelper = CreateObject<RadioEnvironmentMapHelper> ();
+  remHelper->SetAttribute ("ChannelPath", StringValue (channelPath.str ()));
+  remHelper->SetAttribute ("OutputFile", StringValue (fileName));
+  remHelper->SetAttribute ("XMin", DoubleValue (-100.0));
+  remHelper->SetAttribute ("XMax", DoubleValue (400.0));
+  remHelper->SetAttribute ("XRes", UintegerValue (11));
+  remHelper->SetAttribute ("YMin", DoubleValue (-100.0));
+  remHelper->SetAttribute ("YMax", DoubleValue (200.0));
+  remHelper->SetAttribute ("YRes", UintegerValue (7));
+  remHelper->SetAttribute ("Z", DoubleValue (1.5));
+  remHelper->SetAttribute ("RbId", IntegerValue (m_rbId));
+  remHelper->SetAttribute ("Offline", BooleanValue (offline));
+  remHelper->Install ();
+
+  Simulator::Stop (Seconds (1.0));
+  Simulator::Run ();
+  Simulator::Destroy ();
+}
+
+std::vector<std::vector<double> >
+LteRadioEnvironmentMapOfflineTestCase::ReadRem (std::string fileName)
+{
+  std::vector<std::vector<double> > values;
+  std::ifstream inFile (fileName.c_str ());
+  NS_ABORT_MSG_IF (!inFile.is_open (), "Can't open file " << fileName);
+  double x, y, z, sinr;
+  while (inFile >> x >> y >> z >> sinr)
+    {
+      values.push_back (std::vector<double> {x, y, sinr});
+    }
+  return values;
+}
+
+void
+LteRadioEnvironmentMapOfflineTestCase::DoRun (void)
+{
+  std::string onlineFile = CreateTempDirFilename ("rem-online.out");
+  std::string offlineFile = CreateTempDirFilename ("rem-offline.out");
+
+  GenerateRem (false, onlineFile);
+  GenerateRem (true, offlineFile);
+
+  std::vector<std::vector<double> > online = ReadRem (onlineFile);
+  std::vector<std::vector<double> > offline = ReadRem (offlineFile);
+
+  NS_TEST_ASSERT_MSG_EQ (online.size (), 11 * 7, "wrong number of points in the online REM");
+  NS_TEST_ASSERT_MSG_EQ (offline.size (), online.size (), "wrong number of points in the offline REM");
+  for (uint32_t i = 0; i < online.size () && i < offline.size (); ++i)
+    {
+      NS_TEST_ASSERT_MSG_GT (online[i][2], 0, "no signal received at point " << i);
+      NS_TEST_ASSERT_MSG_EQ_TOL (offline[i][0], online[i][0], 1e-6, "wrong x coordinate of point " << i);
+      NS_TEST_ASSERT_MSG_EQ_TOL (offline[i][1], online[i][1], 1e-6, "wrong y coordinate of point " << i);
+      NS_TEST_ASSERT_MSG_EQ_TOL (offline[i][2], online[i][2], online[i][2] * 1e-4,
+                                 "wrong SINR at (" << online[i][0] << ", " << online[i][1] << ")");
+    }
+}
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Radio environment map test suite
+ */
+class LteRadioEnvironmentMapTestSuite : public TestSuite
+{
+public:
+  LteRadioEnvironmentMapTestSuite ();
+};
+
+LteRadioEnvironmentMapTestSuite::LteRadioEnvironmentMapTestSuite ()
+  : TestSuite ("lte-radio-environment-map", SYSTEM)
+{
+  AddTestCase (new LteRadioEnvironmentMapOfflineTestCase (-1), TestCase::QUICK);
+  AddTestCase (new LteRadioEnvironmentMapOfflineTestCase (10), TestCase::QUICK);
+}
+
+static LteRadioEnvironmentMapTestSuite g_lteRadioEnvironmentMapTestSuite;
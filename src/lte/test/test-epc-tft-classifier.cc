@@ -211,6 +211,96 @@ EpcTftClassifierTestCase::DoRun (void)
 
 
 
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test case to check that the per-flow classification cache of the
+ * Tft Classifier is invalidated when TFTs are added or deleted.
+ */
+class EpcTftClassifierCacheTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor
+   *
+   * \param useIpv6 use IPv6 or IPv4 header/addresses
+   */
+  EpcTftClassifierCacheTestCase (bool useIpv6);
+
+private:
+  /**
+   * Classify an uplink UDP packet of the flow used by this test
+   * \param c the EPC TFT classifier
+   * \returns the TFT ID
+   */
+  uint32_t ClassifyPacket (Ptr<EpcTftClassifier> c) const;
+
+  virtual void DoRun (void);
+
+  bool m_useIpv6; ///< use IPv4 or IPv6 header/addresses
+};
+
+EpcTftClassifierCacheTestCase::EpcTftClassifierCacheTestCase (bool useIpv6)
+  : TestCase (useIpv6 ? "TFT classification cache, IPv6" : "TFT classification cache, IPv4"),
+    m_useIpv6 (useIpv6)
+{
+}
+
+uint32_t
+EpcTftClassifierCacheTestCase::ClassifyPacket (Ptr<EpcTftClassifier> c) const
+{
+  UdpHeader udpHeader;
+  udpHeader.SetSourcePort (4);
+  udpHeader.SetDestinationPort (1234);
+  Ptr<Packet> udpPacket = Create<Packet> ();
+  udpPacket->AddHeader (udpHeader);
+  if (m_useIpv6)
+    {
+      Ipv6Header ipv6Header;
+      ipv6Header.SetSourceAddress (Ipv6Address::MakeIpv4MappedAddress (Ipv4Address ("2.2.3.4")));
+      ipv6Header.SetDestinationAddress (Ipv6Address::MakeIpv4MappedAddress (Ipv4Address ("1.1.1.1")));
+      ipv6Header.SetPayloadLength (8);
+      ipv6Header.SetNextHeader (UdpL4Protocol::PROT_NUMBER);
+      udpPacket->AddHeader (ipv6Header);
+      return c->Classify (udpPacket, EpcTft::UPLINK, Ipv6L3Protocol::PROT_NUMBER);
+    }
+  Ipv4Header ipHeader;
+  ipHeader.SetSource (Ipv4Address ("2.2.3.4"));
+  ipHeader.SetDestination (Ipv4Address ("1.1.1.1"));
+  ipHeader.SetPayloadSize (8);
+  ipHeader.SetProtocol (UdpL4Protocol::PROT_NUMBER);
+  udpPacket->AddHeader (ipHeader);
+  return c->Classify (udpPacket, EpcTft::UPLINK, Ipv4L3Protocol::PROT_NUMBER);
+}
+
+void
+EpcTftClassifierCacheTestCase::DoRun (void)
+{
+  Ptr<EpcTftClassifier> c = Create<EpcTftClassifier> ();
+  c->Add (EpcTft::Default (), 1);
+
+  NS_TEST_ASSERT_MSG_EQ (ClassifyPacket (c), 1, "bad classification of first packet of the flow");
+  NS_TEST_ASSERT_MSG_EQ (ClassifyPacket (c), 1, "bad classification of cached flow");
+
+  Ptr<EpcTft> tft = Create<EpcTft> ();
+  EpcTft::PacketFilter pf;
+  pf.direction = EpcTft::UPLINK;
+  pf.remotePortStart = 1234;
+  pf.remotePortEnd = 1234;
+  tft->Add (pf);
+  c->Add (tft, 2);
+  NS_TEST_ASSERT_MSG_EQ (ClassifyPacket (c), 2, "cached classification not updated after adding a TFT");
+
+  c->Delete (2);
+  NS_TEST_ASSERT_MSG_EQ (ClassifyPacket (c), 1, "cached classification not updated after deleting a TFT");
+
+  c->Delete (1);
+  NS_TEST_ASSERT_MSG_EQ (ClassifyPacket (c), 0, "cached classification not updated after deleting all TFTs");
+}
+
+
+
 
 /**
  * \ingroup lte-test
@@ -429,5 +519,12 @@ EpcTftClassifierTestSuite::EpcTftClassifierTestSuite ()
       AddTestCase (new EpcTftClassifierTestCase (c4, EpcTft::UPLINK,   "9.1.1.1", "8.1.1.1",  7895,       10,     0,    1, useIpv6), TestCase::QUICK);
       AddTestCase (new EpcTftClassifierTestCase (c4, EpcTft::UPLINK,   "9.1.1.1", "8.1.1.1",     9,     5897,     0,    2, useIpv6), TestCase::QUICK);
       AddTestCase (new EpcTftClassifierTestCase (c4, EpcTft::DOWNLINK, "9.1.1.1", "8.1.1.1",  5897,       10,     0,    2, useIpv6), TestCase::QUICK);
+
+
+      ///////////////////////////////////////////
+      // check the per-flow classification cache
+      ///////////////////////////////////////////
+
+      AddTestCase (new EpcTftClassifierCacheTestCase (useIpv6), TestCase::QUICK);
     }
 }
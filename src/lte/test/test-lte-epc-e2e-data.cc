@@ -113,19 +113,22 @@ public:
    *
    * \param name the reference name
    * \param v the ENB test data
+   * \param gtpuFastPath whether the EPC applications use the GTP-U fast path
    */
-  LteEpcE2eDataTestCase (std::string name, std::vector<EnbTestData> v);
+  LteEpcE2eDataTestCase (std::string name, std::vector<EnbTestData> v, bool gtpuFastPath = false);
   virtual ~LteEpcE2eDataTestCase ();
 
 private:
   virtual void DoRun (void);
   std::vector<EnbTestData> m_enbTestData; ///< the ENB test data
+  bool m_gtpuFastPath; ///< whether the EPC applications use the GTP-U fast path
 };
 
 
-LteEpcE2eDataTestCase::LteEpcE2eDataTestCase (std::string name, std::vector<EnbTestData> v)
+LteEpcE2eDataTestCase::LteEpcE2eDataTestCase (std::string name, std::vector<EnbTestData> v, bool gtpuFastPath)
   : TestCase (name),
-    m_enbTestData (v)
+    m_enbTestData (v),
+    m_gtpuFastPath (gtpuFastPath)
 {
   NS_LOG_FUNCTION (this << name);
 }
@@ -142,6 +145,7 @@ LteEpcE2eDataTestCase::DoRun ()
   Config::SetDefault ("ns3::LteSpectrumPhy::CtrlErrorModelEnabled", BooleanValue (false));
   Config::SetDefault ("ns3::LteSpectrumPhy::DataErrorModelEnabled", BooleanValue (false));  
   Config::SetDefault ("ns3::LteHelper::UseIdealRrc", BooleanValue (true));
+  Config::SetDefault ("ns3::NoBackhaulEpcHelper::GtpuFastPath", BooleanValue (m_gtpuFastPath));
 
   Config::SetDefault ("ns3::RadioBearerStatsCalculator::DlPdcpOutputFilename", StringValue (CreateTempDirFilename ("DlPdcpStats.txt")));
   Config::SetDefault ("ns3::RadioBearerStatsCalculator::UlPdcpOutputFilename", StringValue (CreateTempDirFilename ("UlPdcpStats.txt")));
@@ -483,5 +487,8 @@ LteEpcE2eDataTestSuite::LteEpcE2eDataTestSuite ()
   v9.push_back (e9);
   AddTestCase (new LteEpcE2eDataTestCase ("1 eNB, 1UE with aggregation", v9), TestCase::EXTENSIVE);
 
+  AddTestCase (new LteEpcE2eDataTestCase ("2 eNBs with GTP-U fast path", v3, true), TestCase::QUICK);
+  AddTestCase (new LteEpcE2eDataTestCase ("1 eNB, 1UE with fragmentation and GTP-U fast path", v8, true), TestCase::EXTENSIVE);
+
 
 }
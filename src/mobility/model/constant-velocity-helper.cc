@@ -34,6 +34,7 @@ ConstantVelocityHelper::ConstantVelocityHelper ()
 }
 ConstantVelocityHelper::ConstantVelocityHelper (const Vector &position)
   : m_position (position),
+    m_origin (position),
     m_paused (true)
 {
   NS_LOG_FUNCTION (this << position);
@@ -41,6 +42,7 @@ ConstantVelocityHelper::ConstantVelocityHelper (const Vector &position)
 ConstantVelocityHelper::ConstantVelocityHelper (const Vector &position,
                                                 const Vector &vel)
   : m_position (position),
+    m_origin (position),
     m_velocity (vel),
     m_paused (true)
 {
@@ -53,6 +55,7 @@ ConstantVelocityHelper::SetPosition (const Vector &position)
   m_position = position;
   m_velocity = Vector (0.0, 0.0, 0.0);
   m_lastUpdate = Simulator::Now ();
+  ResetOrigin ();
 }
 
 Vector
@@ -74,6 +77,14 @@ ConstantVelocityHelper::SetVelocity (const Vector &vel)
   NS_LOG_FUNCTION (this << vel);
   m_velocity = vel;
   m_lastUpdate = Simulator::Now ();
+  ResetOrigin ();
+}
+
+void
+ConstantVelocityHelper::ResetOrigin (void) const
+{
+  m_origin = m_position;
+  m_originTime = m_lastUpdate;
 }
 
 void
@@ -82,16 +93,20 @@ ConstantVelocityHelper::Update (void) const
   NS_LOG_FUNCTION (this);
   Time now = Simulator::Now ();
   NS_ASSERT (m_lastUpdate <= now);
-  Time deltaTime = now - m_lastUpdate;
+  if (now == m_lastUpdate)
+    {
+      return;
+    }
   m_lastUpdate = now;
   if (m_paused)
     {
+      ResetOrigin ();
       return;
     }
-  double deltaS = deltaTime.GetSeconds ();
-  m_position.x += m_velocity.x * deltaS;
-  m_position.y += m_velocity.y * deltaS;
-  m_position.z += m_velocity.z * deltaS;
+  double deltaS = (now - m_originTime).GetSeconds ();
+  m_position.x = m_origin.x + m_velocity.x * deltaS;
+  m_position.y = m_origin.y + m_velocity.y * deltaS;
+  m_position.z = m_origin.z + m_velocity.z * deltaS;
 }
 
 void
@@ -99,10 +114,15 @@ ConstantVelocityHelper::UpdateWithBounds (const Rectangle &bounds) const
 {
   NS_LOG_FUNCTION (this << bounds);
   Update ();
+  Vector position = m_position;
   m_position.x = std::min (bounds.xMax, m_position.x);
   m_position.x = std::max (bounds.xMin, m_position.x);
   m_position.y = std::min (bounds.yMax, m_position.y);
   m_position.y = std::max (bounds.yMin, m_position.y);
+  if (m_position.x != position.x || m_position.y != position.y)
+    {
+      ResetOrigin ();
+    }
 }
 
 void
@@ -110,12 +130,17 @@ ConstantVelocityHelper::UpdateWithBounds (const Box &bounds) const
 {
   NS_LOG_FUNCTION (this << bounds);
   Update ();
+  Vector position = m_position;
   m_position.x = std::min (bounds.xMax, m_position.x);
   m_position.x = std::max (bounds.xMin, m_position.x);
   m_position.y = std::min (bounds.yMax, m_position.y);
   m_position.y = std::max (bounds.yMin, m_position.y);
   m_position.z = std::min (bounds.zMax, m_position.z);
   m_position.z = std::max (bounds.zMin, m_position.z);
+  if (m_position.x != position.x || m_position.y != position.y || m_position.z != position.z)
+    {
+      ResetOrigin ();
+    }
 }
 
 void 
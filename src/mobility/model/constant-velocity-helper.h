@@ -32,6 +32,12 @@ class Rectangle;
  * \ingroup mobility
  *
  * \brief Utility class used to move node with constant velocity.
+ *
+ * The position is evaluated in closed form from the position and time at
+ * which the current leg started (i.e., the last change of position,
+ * velocity, or pause state), rather than by accumulating small increments
+ * at every query.  Repeated queries at the same simulation time reuse the
+ * last computed position.
  */
 class ConstantVelocityHelper
 {
@@ -94,8 +100,15 @@ public:
    */
   void Update (void) const;
 private:
+  /**
+   * Restart the current leg from the current position and time
+   */
+  void ResetOrigin (void) const;
+
   mutable Time m_lastUpdate; //!< time of last update
   mutable Vector m_position; //!< state variable for current position
+  mutable Time m_originTime; //!< time at which the current leg started
+  mutable Vector m_origin; //!< position at which the current leg started
   Vector m_velocity; //!< state variable for velocity
   bool m_paused;  //!< state variable for paused
 };
@@ -30,6 +30,7 @@
 #include "ns3/vector.h"
 #include "ns3/mobility-model.h"
 #include "ns3/waypoint-mobility-model.h"
+#include "ns3/constant-velocity-mobility-model.h"
 #include "ns3/mobility-helper.h"
 
 using namespace ns3;
@@ -410,6 +411,77 @@ WaypointMobilityModelViaHelper::DoRun (void)
   Simulator::Destroy ();
 }
 
+/**
+ * \ingroup mobility-test
+ * \ingroup tests
+ *
+ * \brief Test that positions of a constant velocity model follow the closed-form
+ * trajectory regardless of how often (and how many times per instant) they are queried
+ */
+class ConstantVelocityPositionQueries : public TestCase
+{
+public:
+  ConstantVelocityPositionQueries ();
+  virtual ~ConstantVelocityPositionQueries ();
+
+private:
+  /**
+   * Query the position several times and compare it to the expected one
+   * \param mob the mobility model
+   * \param expected the expected position
+   */
+  void TestPosition (Ptr<const MobilityModel> mob, Vector expected);
+  virtual void DoRun (void);
+};
+
+ConstantVelocityPositionQueries::ConstantVelocityPositionQueries ()
+  : TestCase ("Test closed-form position queries of ConstantVelocityMobilityModel")
+{
+}
+
+ConstantVelocityPositionQueries::~ConstantVelocityPositionQueries ()
+{
+}
+
+void
+ConstantVelocityPositionQueries::TestPosition (Ptr<const MobilityModel> mob, Vector expected)
+{
+  for (uint8_t i = 0; i < 3; i++)
+    {
+      Vector pos = mob->GetPosition ();
+      NS_TEST_EXPECT_MSG_EQ_TOL (pos.x, expected.x, 1e-9, "Position x not equal at " << Simulator::Now ().As (Time::S));
+      NS_TEST_EXPECT_MSG_EQ_TOL (pos.y, expected.y, 1e-9, "Position y not equal at " << Simulator::Now ().As (Time::S));
+      NS_TEST_EXPECT_MSG_EQ_TOL (pos.z, expected.z, 1e-9, "Position z not equal at " << Simulator::Now ().As (Time::S));
+    }
+}
+
+void
+ConstantVelocityPositionQueries::DoRun (void)
+{
+  Ptr<ConstantVelocityMobilityModel> mob = CreateObject<ConstantVelocityMobilityModel> ();
+  mob->SetPosition (Vector (1.0, 2.0, 3.0));
+  Vector velocity (1.5, -2.0, 0.25);
+  mob->SetVelocity (velocity);
+  // first leg: query every millisecond
+  for (uint32_t i = 1; i <= 1000; i++)
+    {
+      double t = i * 0.001;
+      Simulator::Schedule (Seconds (t), &ConstantVelocityPositionQueries::TestPosition, this, mob,
+                           Vector (1.0 + velocity.x * t, 2.0 + velocity.y * t, 3.0 + velocity.z * t));
+    }
+  // second leg: new velocity set at 1 s, sparse queries
+  Vector start (1.0 + velocity.x, 2.0 + velocity.y, 3.0 + velocity.z);
+  Vector velocity2 (-3.0, 0.0, 1.0);
+  Simulator::Schedule (Seconds (1.0), &ConstantVelocityMobilityModel::SetVelocity, mob, velocity2);
+  for (uint32_t i = 1; i <= 10; i++)
+    {
+      Simulator::Schedule (Seconds (1.0 + i), &ConstantVelocityPositionQueries::TestPosition, this, mob,
+                           Vector (start.x + velocity2.x * i, start.y + velocity2.y * i, start.z + velocity2.z * i));
+    }
+  Simulator::Run ();
+  Simulator::Destroy ();
+}
+
 /**
  * \ingroup mobility-test
  * \ingroup tests
@@ -429,6 +501,7 @@ MobilityTestSuite::MobilityTestSuite ()
   AddTestCase (new WaypointLazyNotifyTrue, TestCase::QUICK);
   AddTestCase (new WaypointInitialPositionIsWaypoint, TestCase::QUICK);
   AddTestCase (new WaypointMobilityModelViaHelper, TestCase::QUICK);
+  AddTestCase (new ConstantVelocityPositionQueries, TestCase::QUICK);
 }
 
 static MobilityTestSuite mobilityTestSuite; ///< the test suite
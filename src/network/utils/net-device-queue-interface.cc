@@ -87,9 +87,22 @@ NetDeviceQueue::Wake (void)
   m_stoppedByDevice = false;
 
   // Request the queue disc to dequeue a packet
-  if (wasStoppedByDevice && !m_wakeCallback.IsNull ())
+  if (wasStoppedByDevice)
     {
-      Simulator::ScheduleNow (&NetDeviceQueue::m_wakeCallback, this);
+      ScheduleWake ();
+    }
+}
+
+void
+NetDeviceQueue::ScheduleWake (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  // The device may wake the queue and report transmitted bytes to BQL at the
+  // same time: a single invocation of the wake callback serves both requests
+  if (!m_wakeCallback.IsNull () && !m_wakeEvent.IsRunning ())
+    {
+      m_wakeEvent = Simulator::ScheduleNow (&NetDeviceQueue::m_wakeCallback, this);
     }
 }
 
@@ -140,9 +153,9 @@ NetDeviceQueue::NotifyTransmittedBytes (uint32_t bytes)
   bool wasStoppedByQueueLimits = m_stoppedByQueueLimits;
   m_stoppedByQueueLimits = false;
   // Request the queue disc to dequeue a packet
-  if (wasStoppedByQueueLimits && !m_wakeCallback.IsNull ())
+  if (wasStoppedByQueueLimits)
     {
-      Simulator::ScheduleNow (&NetDeviceQueue::m_wakeCallback, this);
+      ScheduleWake ();
     }
 }
 
@@ -28,6 +28,8 @@
 #include "ns3/log.h"
 #include "ns3/net-device.h"
 #include "ns3/object-factory.h"
+#include "ns3/event-id.h"
+#include "ns3/queue-size.h"
 
 namespace ns3 {
 
@@ -204,10 +206,26 @@ public:
   void ConnectQueueTraces (Ptr<QueueType> queue);
 
 private:
+  /**
+   * \brief Schedule the invocation of the wake callback, unless one is
+   *        already pending
+   */
+  void ScheduleWake (void);
+
+  /**
+   * \brief Check whether a device queue can store another packet whose
+   *        size equals the MTU of the device
+   * \param queue the device queue
+   * \return true if there is room for such a packet
+   */
+  template <typename QueueType>
+  bool HasRoomForMtuPacket (QueueType* queue) const;
+
   bool m_stoppedByDevice;         //!< True if the queue has been stopped by the device
   bool m_stoppedByQueueLimits;    //!< True if the queue has been stopped by a queue limits object
   Ptr<QueueLimits> m_queueLimits; //!< Queue limits object
   WakeCallback m_wakeCallback;    //!< Wake callback
+  EventId m_wakeEvent;            //!< Pending invocation of the wake callback
   Ptr<NetDevice> m_device;        //!< the netdevice aggregated to the NetDeviceQueueInterface
 
   NS_LOG_TEMPLATE_DECLARE;        //!< redefinition of the log component
@@ -346,13 +364,10 @@ NetDeviceQueue::PacketEnqueued (QueueType* queue, Ptr<const typename QueueType::
   // Inform BQL
   NotifyQueuedBytes (item->GetSize ());
 
-  NS_ASSERT_MSG (m_device, "Aggregated NetDevice not set");
-  Ptr<Packet> p = Create<Packet> (m_device->GetMtu ());
-
   // After enqueuing a packet, we need to check whether the queue is able to
   // store another packet. If not, we stop the queue
 
-  if (queue->GetCurrentSize () + p > queue->GetMaxSize ())
+  if (!HasRoomForMtuPacket (queue))
     {
       NS_LOG_DEBUG ("The device queue is being stopped (" << queue->GetCurrentSize ()
                     << " inside)");
@@ -369,19 +384,28 @@ NetDeviceQueue::PacketDequeued (QueueType* queue, Ptr<const typename QueueType::
   // Inform BQL
   NotifyTransmittedBytes (item->GetSize ());
 
-  NS_ASSERT_MSG (m_device, "Aggregated NetDevice not set");
-  Ptr<Packet> p = Create<Packet> (m_device->GetMtu ());
-
   // After dequeuing a packet, if there is room for another packet we
   // call Wake () that ensures that the queue is not stopped and restarts
   // the queue disc if the queue was stopped
 
-  if (queue->GetCurrentSize () + p <= queue->GetMaxSize ())
+  if (HasRoomForMtuPacket (queue))
     {
       Wake ();
     }
 }
 
+template <typename QueueType>
+bool
+NetDeviceQueue::HasRoomForMtuPacket (QueueType* queue) const
+{
+  NS_ASSERT_MSG (m_device, "Aggregated NetDevice not set");
+
+  QueueSize size = queue->GetCurrentSize ();
+  uint32_t increment = (size.GetUnit () == QueueSizeUnit::PACKETS) ? 1 : m_device->GetMtu ();
+
+  return QueueSize (size.GetUnit (), size.GetValue () + increment) <= queue->GetMaxSize ();
+}
+
 template <typename QueueType>
 void
 NetDeviceQueue::PacketDiscarded (QueueType* queue, Ptr<const typename QueueType::ItemType> item)
@@ -1596,15 +1596,102 @@ ThreeGppChannelModel::GetNewChannel (Vector locUT, Ptr<const ChannelCondition> c
         }
     }
 
-  // The following for loops computes the channel coefficients
+  // The field patterns, the polarization terms and the phase shifts of each
+  // ray only depend on the ray angles and on a single antenna element.
+  // Compute them once here instead of once per (u, s) element pair.
+  Complex2DVector rayCoefficients (numReducedCluster, ThreeGppAntennaArrayModel::ComplexVector (raysPerCluster));
+  for (uint8_t nIndex = 0; nIndex < numReducedCluster; nIndex++)
+    {
+      for (uint8_t mIndex = 0; mIndex < raysPerCluster; mIndex++)
+        {
+          const DoubleVector &initialPhase = clusterPhase[nIndex][mIndex];
+          double k = crossPolarizationPowerRatios[nIndex][mIndex];
+
+          double rxFieldPatternPhi, rxFieldPatternTheta, txFieldPatternPhi, txFieldPatternTheta;
+          std::tie (rxFieldPatternPhi, rxFieldPatternTheta) = uAntenna->GetElementFieldPattern (Angles (rayAoa_radian[nIndex][mIndex], rayZoa_radian[nIndex][mIndex]));
+          std::tie (txFieldPatternPhi, txFieldPatternTheta) = sAntenna->GetElementFieldPattern (Angles (rayAod_radian[nIndex][mIndex], rayZod_radian[nIndex][mIndex]));
+
+          rayCoefficients[nIndex][mIndex] = (exp (std::complex<double> (0, initialPhase[0])) * rxFieldPatternTheta * txFieldPatternTheta +
+                                             +exp (std::complex<double> (0, initialPhase[1])) * std::sqrt (1 / k) * rxFieldPatternTheta * txFieldPatternPhi +
+                                             +exp (std::complex<double> (0, initialPhase[2])) * std::sqrt (1 / k) * rxFieldPatternPhi * txFieldPatternTheta +
+                                             +exp (std::complex<double> (0, initialPhase[3])) * rxFieldPatternPhi * txFieldPatternPhi);
+        }
+    }
+
+  //lambda_0 is accounted in the antenna spacing uLoc and sLoc.
+  Complex3DVector rxPhaseShifts (uSize, Complex2DVector (numReducedCluster, ThreeGppAntennaArrayModel::ComplexVector (raysPerCluster)));
   for (uint64_t uIndex = 0; uIndex < uSize; uIndex++)
     {
       Vector uLoc = uAntenna->GetElementLocation (uIndex);
+      for (uint8_t nIndex = 0; nIndex < numReducedCluster; nIndex++)
+        {
+          for (uint8_t mIndex = 0; mIndex < raysPerCluster; mIndex++)
+            {
+              double rxPhaseDiff = 2 * M_PI * (sin (rayZoa_radian[nIndex][mIndex]) * cos (rayAoa_radian[nIndex][mIndex]) * uLoc.x
+                                               + sin (rayZoa_radian[nIndex][mIndex]) * sin (rayAoa_radian[nIndex][mIndex]) * uLoc.y
+                                               + cos (rayZoa_radian[nIndex][mIndex]) * uLoc.z);
+              rxPhaseShifts[uIndex][nIndex][mIndex] = exp (std::complex<double> (0, rxPhaseDiff));
+            }
+        }
+    }
+  Complex3DVector txPhaseShifts (sSize, Complex2DVector (numReducedCluster, ThreeGppAntennaArrayModel::ComplexVector (raysPerCluster)));
+  for (uint64_t sIndex = 0; sIndex < sSize; sIndex++)
+    {
+      Vector sLoc = sAntenna->GetElementLocation (sIndex);
+      for (uint8_t nIndex = 0; nIndex < numReducedCluster; nIndex++)
+        {
+          for (uint8_t mIndex = 0; mIndex < raysPerCluster; mIndex++)
+            {
+              double txPhaseDiff = 2 * M_PI * (sin (rayZod_radian[nIndex][mIndex]) * cos (rayAod_radian[nIndex][mIndex]) * sLoc.x
+                                               + sin (rayZod_radian[nIndex][mIndex]) * sin (rayAod_radian[nIndex][mIndex]) * sLoc.y
+                                               + cos (rayZod_radian[nIndex][mIndex]) * sLoc.z);
+              txPhaseShifts[sIndex][nIndex][mIndex] = exp (std::complex<double> (0, txPhaseDiff));
+            }
+        }
+    }
+
+  // same for the LOS ray, if any
+  std::complex<double> losCoefficient (0, 0);
+  ThreeGppAntennaArrayModel::ComplexVector losRxPhaseShifts;
+  ThreeGppAntennaArrayModel::ComplexVector losTxPhaseShifts;
+  double K_linear = pow (10,K_factor / 10);
+  if (los)
+    {
+      double rxFieldPatternPhi, rxFieldPatternTheta, txFieldPatternPhi, txFieldPatternTheta;
+      std::tie (rxFieldPatternPhi, rxFieldPatternTheta) = uAntenna->GetElementFieldPattern (Angles (uAngle.phi, uAngle.theta));
+      std::tie (txFieldPatternPhi, txFieldPatternTheta) = sAntenna->GetElementFieldPattern (Angles (sAngle.phi, sAngle.theta));
+
+      double lambda = 3e8 / m_frequency; // the wavelength of the carrier frequency
+
+      losCoefficient = (rxFieldPatternTheta * txFieldPatternTheta - rxFieldPatternPhi * txFieldPatternPhi)
+        * exp (std::complex<double> (0, -2 * M_PI * dis3D / lambda));
 
+      for (uint64_t uIndex = 0; uIndex < uSize; uIndex++)
+        {
+          Vector uLoc = uAntenna->GetElementLocation (uIndex);
+          double rxPhaseDiff = 2 * M_PI * (sin (uAngle.theta) * cos (uAngle.phi) * uLoc.x
+                                           + sin (uAngle.theta) * sin (uAngle.phi) * uLoc.y
+                                           + cos (uAngle.theta) * uLoc.z);
+          losRxPhaseShifts.push_back (exp (std::complex<double> (0, rxPhaseDiff)));
+        }
       for (uint64_t sIndex = 0; sIndex < sSize; sIndex++)
         {
-
           Vector sLoc = sAntenna->GetElementLocation (sIndex);
+          double txPhaseDiff = 2 * M_PI * (sin (sAngle.theta) * cos (sAngle.phi) * sLoc.x
+                                           + sin (sAngle.theta) * sin (sAngle.phi) * sLoc.y
+                                           + cos (sAngle.theta) * sLoc.z);
+          losTxPhaseShifts.push_back (exp (std::complex<double> (0, txPhaseDiff)));
+        }
+    }
+
+  // The following for loops computes the channel coefficients
+  for (uint64_t uIndex = 0; uIndex < uSize; uIndex++)
+    {
+      const Complex2DVector &rxShifts = rxPhaseShifts[uIndex];
+
+      for (uint64_t sIndex = 0; sIndex < sSize; sIndex++)
+        {
+          const Complex2DVector &txShifts = txPhaseShifts[sIndex];
 
           for (uint8_t nIndex = 0; nIndex < numReducedCluster; nIndex++)
             {
@@ -1614,28 +1701,8 @@ ThreeGppChannelModel::GetNewChannel (Vector locUT, Ptr<const ChannelCondition> c
                   std::complex<double> rays (0,0);
                   for (uint8_t mIndex = 0; mIndex < raysPerCluster; mIndex++)
                     {
-                      DoubleVector initialPhase = clusterPhase[nIndex][mIndex];
-                      double k = crossPolarizationPowerRatios[nIndex][mIndex];
-                      //lambda_0 is accounted in the antenna spacing uLoc and sLoc.
-                      double rxPhaseDiff = 2 * M_PI * (sin (rayZoa_radian[nIndex][mIndex]) * cos (rayAoa_radian[nIndex][mIndex]) * uLoc.x
-                                                       + sin (rayZoa_radian[nIndex][mIndex]) * sin (rayAoa_radian[nIndex][mIndex]) * uLoc.y
-                                                       + cos (rayZoa_radian[nIndex][mIndex]) * uLoc.z);
-
-                      double txPhaseDiff = 2 * M_PI * (sin (rayZod_radian[nIndex][mIndex]) * cos (rayAod_radian[nIndex][mIndex]) * sLoc.x
-                                                       + sin (rayZod_radian[nIndex][mIndex]) * sin (rayAod_radian[nIndex][mIndex]) * sLoc.y
-                                                       + cos (rayZod_radian[nIndex][mIndex]) * sLoc.z);
                       // NOTE Doppler is computed in the CalcBeamformingGain function and is simplified to only account for the center anngle of each cluster.
-
-                      double rxFieldPatternPhi, rxFieldPatternTheta, txFieldPatternPhi, txFieldPatternTheta;
-                      std::tie (rxFieldPatternPhi, rxFieldPatternTheta) = uAntenna->GetElementFieldPattern (Angles (rayAoa_radian[nIndex][mIndex], rayZoa_radian[nIndex][mIndex]));
-                      std::tie (txFieldPatternPhi, txFieldPatternTheta) = sAntenna->GetElementFieldPattern (Angles (rayAod_radian[nIndex][mIndex], rayZod_radian[nIndex][mIndex]));
-
-                      rays += (exp (std::complex<double> (0, initialPhase[0])) * rxFieldPatternTheta * txFieldPatternTheta +
-                               +exp (std::complex<double> (0, initialPhase[1])) * std::sqrt (1 / k) * rxFieldPatternTheta * txFieldPatternPhi +
-                               +exp (std::complex<double> (0, initialPhase[2])) * std::sqrt (1 / k) * rxFieldPatternPhi * txFieldPatternTheta +
-                               +exp (std::complex<double> (0, initialPhase[3])) * rxFieldPatternPhi * txFieldPatternPhi)
-                        * exp (std::complex<double> (0, rxPhaseDiff))
-                        * exp (std::complex<double> (0, txPhaseDiff));
+                      rays += rayCoefficients[nIndex][mIndex] * rxShifts[nIndex][mIndex] * txShifts[nIndex][mIndex];
                     }
                   rays *= sqrt (clusterPower[nIndex] / raysPerCluster);
                   H_usn[uIndex][sIndex][nIndex] = rays;
@@ -1648,21 +1715,8 @@ ThreeGppChannelModel::GetNewChannel (Vector locUT, Ptr<const ChannelCondition> c
 
                   for (uint8_t mIndex = 0; mIndex < raysPerCluster; mIndex++)
                     {
-                      double k = crossPolarizationPowerRatios[nIndex][mIndex];
-
                       //ZML:Just remind me that the angle offsets for the 3 subclusters were not generated correctly.
-
-                      DoubleVector initialPhase = clusterPhase[nIndex][mIndex];
-                      double rxPhaseDiff = 2 * M_PI * (sin (rayZoa_radian[nIndex][mIndex]) * cos (rayAoa_radian[nIndex][mIndex]) * uLoc.x
-                                                       + sin (rayZoa_radian[nIndex][mIndex]) * sin (rayAoa_radian[nIndex][mIndex]) * uLoc.y
-                                                       + cos (rayZoa_radian[nIndex][mIndex]) * uLoc.z);
-                      double txPhaseDiff = 2 * M_PI * (sin (rayZod_radian[nIndex][mIndex]) * cos (rayAod_radian[nIndex][mIndex]) * sLoc.x
-                                                       + sin (rayZod_radian[nIndex][mIndex]) * sin (rayAod_radian[nIndex][mIndex]) * sLoc.y
-                                                       + cos (rayZod_radian[nIndex][mIndex]) * sLoc.z);
-
-                      double rxFieldPatternPhi, rxFieldPatternTheta, txFieldPatternPhi, txFieldPatternTheta;
-                      std::tie (rxFieldPatternPhi, rxFieldPatternTheta) = uAntenna->GetElementFieldPattern (Angles (rayAoa_radian[nIndex][mIndex], rayZoa_radian[nIndex][mIndex]));
-                      std::tie (txFieldPatternPhi, txFieldPatternTheta) = sAntenna->GetElementFieldPattern (Angles (rayAod_radian[nIndex][mIndex], rayZod_radian[nIndex][mIndex]));
+                      std::complex<double> ray = rayCoefficients[nIndex][mIndex] * rxShifts[nIndex][mIndex] * txShifts[nIndex][mIndex];
 
                       switch (mIndex)
                         {
@@ -1672,31 +1726,16 @@ ThreeGppChannelModel::GetNewChannel (Vector locUT, Ptr<const ChannelCondition> c
                           case 12:
                           case 17:
                           case 18:
-                            raysSub2 += (exp (std::complex<double> (0, initialPhase[0])) * rxFieldPatternTheta * txFieldPatternTheta +
-                                         +exp (std::complex<double> (0, initialPhase[1])) * std::sqrt (1 / k) * rxFieldPatternTheta * txFieldPatternPhi +
-                                         +exp (std::complex<double> (0, initialPhase[2])) * std::sqrt (1 / k) * rxFieldPatternPhi * txFieldPatternTheta +
-                                         +exp (std::complex<double> (0, initialPhase[3])) * rxFieldPatternPhi * txFieldPatternPhi)
-                              * exp (std::complex<double> (0, rxPhaseDiff))
-                              * exp (std::complex<double> (0, txPhaseDiff));
+                            raysSub2 += ray;
                             break;
                           case 13:
                           case 14:
                           case 15:
                           case 16:
-                            raysSub3 += (exp (std::complex<double> (0, initialPhase[0])) * rxFieldPatternTheta * txFieldPatternTheta +
-                                         +exp (std::complex<double> (0, initialPhase[1])) * std::sqrt (1 / k) * rxFieldPatternTheta * txFieldPatternPhi +
-                                         +exp (std::complex<double> (0, initialPhase[2])) * std::sqrt (1 / k) * rxFieldPatternPhi * txFieldPatternTheta +
-                                         +exp (std::complex<double> (0, initialPhase[3])) * rxFieldPatternPhi * txFieldPatternPhi)
-                              * exp (std::complex<double> (0, rxPhaseDiff))
-                              * exp (std::complex<double> (0, txPhaseDiff));
+                            raysSub3 += ray;
                             break;
                           default:                      //case 1,2,3,4,5,6,7,8,19,20
-                            raysSub1 += (exp (std::complex<double> (0, initialPhase[0])) * rxFieldPatternTheta * txFieldPatternTheta +
-                                         +exp (std::complex<double> (0, initialPhase[1])) * std::sqrt (1 / k) * rxFieldPatternTheta * txFieldPatternPhi +
-                                         +exp (std::complex<double> (0, initialPhase[2])) * std::sqrt (1 / k) * rxFieldPatternPhi * txFieldPatternTheta +
-                                         +exp (std::complex<double> (0, initialPhase[3])) * rxFieldPatternPhi * txFieldPatternPhi)
-                              * exp (std::complex<double> (0, rxPhaseDiff))
-                              * exp (std::complex<double> (0, txPhaseDiff));
+                            raysSub1 += ray;
                             break;
                         }
                     }
@@ -1711,26 +1750,8 @@ ThreeGppChannelModel::GetNewChannel (Vector locUT, Ptr<const ChannelCondition> c
             }
           if (los) //(7.5-29) && (7.5-30)
             {
-              std::complex<double> ray (0,0);
-              double rxPhaseDiff = 2 * M_PI * (sin (uAngle.theta) * cos (uAngle.phi) * uLoc.x
-                                               + sin (uAngle.theta) * sin (uAngle.phi) * uLoc.y
-                                               + cos (uAngle.theta) * uLoc.z);
-              double txPhaseDiff = 2 * M_PI * (sin (sAngle.theta) * cos (sAngle.phi) * sLoc.x
-                                               + sin (sAngle.theta) * sin (sAngle.phi) * sLoc.y
-                                               + cos (sAngle.theta) * sLoc.z);
-
-              double rxFieldPatternPhi, rxFieldPatternTheta, txFieldPatternPhi, txFieldPatternTheta;
-              std::tie (rxFieldPatternPhi, rxFieldPatternTheta) = uAntenna->GetElementFieldPattern (Angles (uAngle.phi, uAngle.theta));
-              std::tie (txFieldPatternPhi, txFieldPatternTheta) = sAntenna->GetElementFieldPattern (Angles (sAngle.phi, sAngle.theta));
-
-              double lambda = 3e8 / m_frequency; // the wavelength of the carrier frequency
-
-              ray = (rxFieldPatternTheta * txFieldPatternTheta - rxFieldPatternPhi * txFieldPatternPhi)
-                * exp (std::complex<double> (0, -2 * M_PI * dis3D / lambda))
-                * exp (std::complex<double> (0, rxPhaseDiff))
-                * exp (std::complex<double> (0, txPhaseDiff));
-
-              double K_linear = pow (10,K_factor / 10);
+              std::complex<double> ray = losCoefficient * losRxPhaseShifts[uIndex] * losTxPhaseShifts[sIndex];
+
               // the LOS path should be attenuated if blockage is enabled.
               H_usn[uIndex][sIndex][0] = sqrt (1 / (K_linear + 1)) * H_usn[uIndex][sIndex][0] + sqrt (K_linear / (1 + K_linear)) * ray / pow (10,attenuation_dB[0] / 10);           //(7.5-30) for tau = tau1
               double tempSize = H_usn[uIndex][sIndex].size ();
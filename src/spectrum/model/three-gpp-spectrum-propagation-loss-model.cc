@@ -136,6 +136,7 @@ ThreeGppSpectrumPropagationLossModel::CalcLongTerm (Ptr<const MatrixBasedChannel
   //only the small scale fading needs to be updated if the large scale parameters and antenna weights remain unchanged.
   ThreeGppAntennaArrayModel::ComplexVector longTerm;
   uint8_t numCluster = static_cast<uint8_t> (params->m_channel[0][0].size ());
+  longTerm.reserve (numCluster);
 
   for (uint8_t cIndex = 0; cIndex < numCluster; cIndex++)
     {
@@ -171,7 +172,10 @@ ThreeGppSpectrumPropagationLossModel::CalcBeamformingGain (Ptr<SpectrumValue> tx
   // NOTE the update of Doppler is simplified by only taking the center angle of
   // each cluster in to consideration.
   double slotTime = Simulator::Now ().GetSeconds ();
+  // the frequency is retrieved through the attribute system, do it only once
+  double frequency = GetFrequency ();
   ThreeGppAntennaArrayModel::ComplexVector doppler;
+  doppler.reserve (numCluster);
   for (uint8_t cIndex = 0; cIndex < numCluster; cIndex++)
     {
       // Compute alpha and D as described in 3GPP TR 37.885 v15.3.0, Sec. 6.2.3
@@ -199,10 +203,19 @@ ThreeGppSpectrumPropagationLossModel::CalcBeamformingGain (Ptr<SpectrumValue> tx
                                          + (sin (params->m_angle[MatrixBasedChannelModel::ZOD_INDEX][cIndex] * M_PI / 180) * cos (params->m_angle[MatrixBasedChannelModel::AOD_INDEX][cIndex] * M_PI / 180) * sSpeed.x
                                          + sin (params->m_angle[MatrixBasedChannelModel::ZOD_INDEX][cIndex] * M_PI / 180) * sin (params->m_angle[MatrixBasedChannelModel::AOD_INDEX][cIndex] * M_PI / 180) * sSpeed.y
                                          + cos (params->m_angle[MatrixBasedChannelModel::ZOD_INDEX][cIndex] * M_PI / 180) * sSpeed.z) + 2 * alpha * D)
-                           * slotTime * GetFrequency () / 3e8;
+                           * slotTime * frequency / 3e8;
       doppler.push_back (exp (std::complex<double> (0, temp_doppler)));
     }
 
+  // the product of the long term component and of the doppler term does not
+  // depend on the sub-band
+  ThreeGppAntennaArrayModel::ComplexVector longTermDoppler;
+  longTermDoppler.reserve (numCluster);
+  for (uint8_t cIndex = 0; cIndex < numCluster; cIndex++)
+    {
+      longTermDoppler.push_back (longTerm[cIndex] * doppler[cIndex]);
+    }
+
   // apply the doppler term and the propagation delay to the long term component
   // to obtain the beamforming gain
   auto vit = tempPsd->ValuesBegin (); // psd iterator
@@ -216,7 +229,7 @@ ThreeGppSpectrumPropagationLossModel::CalcBeamformingGain (Ptr<SpectrumValue> tx
           for (uint8_t cIndex = 0; cIndex < numCluster; cIndex++)
             {
               double delay = -2 * M_PI * fsb * (params->m_delay[cIndex]);
-              subsbandGain = subsbandGain + longTerm[cIndex] * doppler[cIndex] * exp (std::complex<double> (0, delay));
+              subsbandGain = subsbandGain + longTermDoppler[cIndex] * exp (std::complex<double> (0, delay));
             }
           *vit = (*vit) * (norm (subsbandGain));
         }
@@ -232,67 +245,50 @@ ThreeGppSpectrumPropagationLossModel::GetLongTerm (uint32_t aId, uint32_t bId,
                                                    const ThreeGppAntennaArrayModel::ComplexVector &aW,
                                                    const ThreeGppAntennaArrayModel::ComplexVector &bW) const
 {
-  ThreeGppAntennaArrayModel::ComplexVector longTerm; // vector containing the long term component for each cluster
-
   // check if the channel matrix was generated considering a as the s-node and
   // b as the u-node or viceversa
-  ThreeGppAntennaArrayModel::ComplexVector sW, uW;
-  if (!channelMatrix->IsReverse (aId, bId))
-  {
-    sW = aW;
-    uW = bW;
-  }
-  else
-  {
-    sW = bW;
-    uW = aW;
-  }
+  bool reverse = channelMatrix->IsReverse (aId, bId);
+  const ThreeGppAntennaArrayModel::ComplexVector &sW = reverse ? bW : aW;
+  const ThreeGppAntennaArrayModel::ComplexVector &uW = reverse ? aW : bW;
 
   // compute the long term key, the key is unique for each tx-rx pair
   uint32_t x1 = std::min (aId, bId);
   uint32_t x2 = std::max (aId, bId);
   uint32_t longTermId = MatrixBasedChannelModel::GetKey (x1, x2);
 
-  bool update = false; // indicates whether the long term has to be updated
-  bool notFound = false; // indicates if the long term has not been computed yet
-
   // look for the long term in the map and check if it is valid
-  if (m_longTermMap.find (longTermId) != m_longTermMap.end ())
+  auto it = m_longTermMap.find (longTermId);
+  if (it != m_longTermMap.end ())
   {
     NS_LOG_DEBUG ("found the long term component in the map");
-    longTerm = m_longTermMap[longTermId]->m_longTerm;
 
     // check if the channel matrix has been updated
     // or the s beam has been changed
     // or the u beam has been changed
-    update = (m_longTermMap[longTermId]->m_channel->m_generatedTime != channelMatrix->m_generatedTime
-              || m_longTermMap[longTermId]->m_sW != sW
-              || m_longTermMap[longTermId]->m_uW != uW);
-
+    if (it->second->m_channel->m_generatedTime == channelMatrix->m_generatedTime
+        && it->second->m_sW == sW
+        && it->second->m_uW == uW)
+      {
+        return it->second->m_longTerm;
+      }
   }
   else
   {
     NS_LOG_DEBUG ("long term component NOT found");
-    notFound = true;
   }
 
-  if (update || notFound)
-    {
-      NS_LOG_DEBUG ("compute the long term");
-      // compute the long term component
-      longTerm = CalcLongTerm (channelMatrix, sW, uW);
-
-      // store the long term
-      Ptr<LongTerm> longTermItem = Create<LongTerm> ();
-      longTermItem->m_longTerm = longTerm;
-      longTermItem->m_channel = channelMatrix;
-      longTermItem->m_sW = sW;
-      longTermItem->m_uW = uW;
-
-      m_longTermMap[longTermId] = longTermItem;
-    }
+  NS_LOG_DEBUG ("compute the long term");
+  // compute the long term component
+  Ptr<LongTerm> longTermItem = Create<LongTerm> ();
+  longTermItem->m_longTerm = CalcLongTerm (channelMatrix, sW, uW);
+  longTermItem->m_channel = channelMatrix;
+  longTermItem->m_sW = sW;
+  longTermItem->m_uW = uW;
 
-  return longTerm;
+  // store the long term
+  m_longTermMap[longTermId] = longTermItem;
+
+  return longTermItem->m_longTerm;
 }
 
 Ptr<SpectrumValue>
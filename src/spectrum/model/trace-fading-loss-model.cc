@@ -27,6 +27,7 @@
 #include <ns3/string.h>
 #include <ns3/double.h>
 #include "ns3/uinteger.h"
+#include "ns3/abort.h"
 #include <fstream>
 #include <ns3/simulator.h>
 
@@ -48,7 +49,7 @@ TraceFadingLossModel::TraceFadingLossModel ()
 
 TraceFadingLossModel::~TraceFadingLossModel ()
 {
-  m_fadingTrace.clear ();
+  ReleaseTrace ();
   m_windowOffsetsMap.clear ();
   m_startVariableMap.clear ();
 }
@@ -116,36 +117,82 @@ TraceFadingLossModel::DoInitialize ()
 }
 
 
+std::map<TraceFadingLossModel::FadingTraceId_t, Ptr<TraceFadingLossModel::FadingTrace> >&
+TraceFadingLossModel::GetTraceCache ()
+{
+  static std::map<FadingTraceId_t, Ptr<FadingTrace> > cache;
+  return cache;
+}
+
 void
 TraceFadingLossModel::LoadTrace ()
 {
   NS_LOG_FUNCTION (this << "Loading Fading Trace " << m_traceFile);
-  std::ifstream ifTraceFile;
-  ifTraceFile.open (m_traceFile.c_str (), std::ifstream::in);
-  m_fadingTrace.clear ();
-  if (!ifTraceFile.good ())
+  ReleaseTrace ();
+
+  // instances loading the same trace share a single copy of the samples
+  FadingTraceId_t traceId = std::make_pair (m_traceFile, std::make_pair (static_cast<uint32_t> (m_rbNum), m_samplesNum));
+  std::map<FadingTraceId_t, Ptr<FadingTrace> >& cache = GetTraceCache ();
+  std::map<FadingTraceId_t, Ptr<FadingTrace> >::iterator it = cache.find (traceId);
+  if (it != cache.end ())
     {
-      NS_LOG_INFO (this << " File: " << m_traceFile);
-      NS_ASSERT_MSG(ifTraceFile.good (), " Fading trace file not found");
+      NS_LOG_LOGIC (this << " reusing already loaded trace " << m_traceFile);
+      m_fadingTrace = it->second;
     }
-
-//   NS_LOG_INFO (this << " length " << m_traceLength.GetSeconds ());
-//   NS_LOG_INFO (this << " RB " << (uint32_t)m_rbNum << " samples " << m_samplesNum);
-  for (uint32_t i = 0; i < m_rbNum; i++)
+  else
     {
-      FadingTraceSample rbTimeFadingTrace;
-      for (uint32_t j = 0; j < m_samplesNum; j++)
+      std::ifstream ifTraceFile;
+      ifTraceFile.open (m_traceFile.c_str (), std::ifstream::in);
+      if (!ifTraceFile.good ())
         {
-          double sample;
-          ifTraceFile >> sample;
-          rbTimeFadingTrace.push_back (sample);
+          NS_LOG_INFO (this << " File: " << m_traceFile);
+          NS_ASSERT_MSG(ifTraceFile.good (), " Fading trace file not found");
         }
-      m_fadingTrace.push_back (rbTimeFadingTrace);
+
+      m_fadingTrace = Create<FadingTrace> ();
+      m_fadingTrace->samples.resize (static_cast<size_t> (m_rbNum) * m_samplesNum);
+      std::vector<float>::iterator sampleIt = m_fadingTrace->samples.begin ();
+      for (uint32_t i = 0; i < m_rbNum; i++)
+        {
+          for (uint32_t j = 0; j < m_samplesNum; j++)
+            {
+              double sample;
+              ifTraceFile >> sample;
+              *sampleIt++ = static_cast<float> (sample);
+            }
+        }
+      cache.insert (std::make_pair (traceId, m_fadingTrace));
     }
   m_timeGranularity = m_traceLength.GetMilliSeconds () / m_samplesNum;
   m_lastWindowUpdate = Simulator::Now ();
 }
 
+void
+TraceFadingLossModel::ReleaseTrace ()
+{
+  NS_LOG_FUNCTION (this);
+  if (m_fadingTrace == 0)
+    {
+      return;
+    }
+  m_fadingTrace = 0;
+
+  // drop the traces that are only referenced by the cache
+  std::map<FadingTraceId_t, Ptr<FadingTrace> >& cache = GetTraceCache ();
+  std::map<FadingTraceId_t, Ptr<FadingTrace> >::iterator it = cache.begin ();
+  while (it != cache.end ())
+    {
+      if (it->second->GetReferenceCount () == 1)
+        {
+          cache.erase (it++);
+        }
+      else
+        {
+          ++it;
+        }
+    }
+}
+
 
 Ptr<SpectrumValue>
 TraceFadingLossModel::DoCalcRxPowerSpectralDensity (
@@ -201,7 +248,7 @@ TraceFadingLossModel::DoCalcRxPowerSpectralDensity (
   //double speed = std::sqrt (std::pow (aSpeedVector.x-bSpeedVector.x,2) + std::pow (aSpeedVector.y-bSpeedVector.y,2));
 
   NS_LOG_LOGIC (this << *rxPsd);
-  NS_ASSERT (!m_fadingTrace.empty ());
+  NS_ASSERT (m_fadingTrace != 0);
   int now_ms = static_cast<int> (Simulator::Now ().GetMilliSeconds () * m_timeGranularity);
   int lastUpdate_ms = static_cast<int> (m_lastWindowUpdate.GetMilliSeconds () * m_timeGranularity);
   int index = ((*itOff).second + now_ms - lastUpdate_ms) % m_samplesNum;
@@ -211,7 +258,8 @@ TraceFadingLossModel::DoCalcRxPowerSpectralDensity (
       NS_ASSERT (subChannel < 100);
       if (*vit != 0.)
         {
-          double fading = m_fadingTrace.at (subChannel).at (index);
+          NS_ABORT_MSG_IF (subChannel >= m_rbNum, "The fading trace has " << static_cast<uint32_t> (m_rbNum) << " RBs, band " << subChannel << " is out of range; check the RbNum attribute");
+          double fading = m_fadingTrace->samples[subChannel * m_samplesNum + index];
           NS_LOG_INFO (this << " FADING now " << now_ms << " offset " << (*itOff).second << " id " << index << " fading " << fading);
           double power = *vit; // in Watt/Hz
           power = 10 * std::log10 (180000 * power); // in dB
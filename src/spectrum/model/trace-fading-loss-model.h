@@ -25,8 +25,10 @@
 
 
 #include <ns3/object.h>
+#include <ns3/simple-ref-count.h>
 #include <ns3/spectrum-propagation-loss-model.h>
 #include <map>
+#include <vector>
 #include "ns3/random-variable-stream.h"
 #include <ns3/nstime.h>
 
@@ -106,6 +108,9 @@ private:
   /// Load trace function
   void LoadTrace ();
 
+  /// Release the shared trace, dropping it from the cache if no longer used
+  void ReleaseTrace ();
+
 
    
   mutable std::map <ChannelRealizationId_t, int > m_windowOffsetsMap; ///< windows offsets map
@@ -113,19 +118,30 @@ private:
   mutable std::map <ChannelRealizationId_t, Ptr<UniformRandomVariable> > m_startVariableMap; ///< start variable map
   
   /**
-   * Vector with fading samples in time domain (for a fixed RB)
+   * \brief Fading samples of a trace file, shared by all the instances
+   *        loading the same file with the same RB and sample numbers.
+   *
+   * The samples are stored in single precision and RB-major order, i.e.,
+   * the sample of RB \p rb at time index \p t is found at
+   * <tt>rb * samplesNum + t</tt>.
    */
-  typedef std::vector<double> FadingTraceSample;
+  struct FadingTrace : public SimpleRefCount<FadingTrace>
+  {
+    std::vector<float> samples; ///< fading samples in dB
+  };
+
+  /// Identifies a loaded trace: file name, RB number and samples number
+  typedef std::pair<std::string, std::pair<uint32_t, uint32_t> > FadingTraceId_t;
+
   /**
-   * Vector collecting the time fading traces in the frequency domain (per RB)
+   * \brief Get the cache of the traces currently loaded by any instance
+   * \return the trace cache
    */
-  typedef std::vector<FadingTraceSample> FadingTrace;
+  static std::map<FadingTraceId_t, Ptr<FadingTrace> >& GetTraceCache ();
 
-
-  
   std::string m_traceFile; ///< the trace file name
   
-  FadingTrace m_fadingTrace; ///< fading trace
+  Ptr<FadingTrace> m_fadingTrace; ///< fading trace, possibly shared with other instances
 
   
   Time m_traceLength; ///< the trace time
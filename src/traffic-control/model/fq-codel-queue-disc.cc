@@ -208,11 +208,11 @@ FqCoDelQueueDisc::SetAssociativeHash (uint32_t flowHash)
 
   for (uint32_t i = outerHash; i < outerHash + m_setWays; i++)
     {
-      auto it = m_flowsIndices.find (i);
-
-      if (it == m_flowsIndices.end ()
-          || (m_tags.find (i) != m_tags.end () && m_tags[i] == flowHash)
-          || StaticCast<FqCoDelFlow> (GetQueueDiscClass (it->second))->GetStatus () == FqCoDelFlow::INACTIVE)
+      // the tag of a queue is set before the queue is created, hence it is
+      // only meaningful for the queues that exist
+      if (!m_flowsByIndex[i]
+          || m_tags[i] == flowHash
+          || m_flowsByIndex[i]->GetStatus () == FqCoDelFlow::INACTIVE)
         {
           // this queue has not been created yet or is associated with this flow
           // or is inactive, hence we can use it
@@ -262,8 +262,8 @@ FqCoDelQueueDisc::DoEnqueue (Ptr<QueueDiscItem> item)
       h = flowHash % m_flows;
     }
 
-  Ptr<FqCoDelFlow> flow;
-  if (m_flowsIndices.find (h) == m_flowsIndices.end ())
+  Ptr<FqCoDelFlow> flow = m_flowsByIndex[h];
+  if (!flow)
     {
       NS_LOG_DEBUG ("Creating a new flow queue with index " << h);
       flow = m_flowFactory.Create<FqCoDelFlow> ();
@@ -281,11 +281,7 @@ FqCoDelQueueDisc::DoEnqueue (Ptr<QueueDiscItem> item)
       flow->SetIndex (h);
       AddQueueDiscClass (flow);
 
-      m_flowsIndices[h] = GetNQueueDiscClasses () - 1;
-    }
-  else
-    {
-      flow = StaticCast<FqCoDelFlow> (GetQueueDiscClass (m_flowsIndices[h]));
+      m_flowsByIndex[h] = flow;
     }
 
   if (flow->GetStatus () == FqCoDelFlow::INACTIVE)
@@ -297,7 +293,7 @@ FqCoDelQueueDisc::DoEnqueue (Ptr<QueueDiscItem> item)
 
   flow->GetQueueDisc ()->Enqueue (item);
 
-  NS_LOG_DEBUG ("Packet enqueued into flow " << h << "; flow index " << m_flowsIndices[h]);
+  NS_LOG_DEBUG ("Packet enqueued into flow " << h);
 
   if (GetCurrentSize () > GetMaxSize ())
     {
@@ -457,6 +453,10 @@ FqCoDelQueueDisc::InitializeParams (void)
   m_queueDiscFactory.Set ("MaxSize", QueueSizeValue (GetMaxSize ()));
   m_queueDiscFactory.Set ("Interval", StringValue (m_interval));
   m_queueDiscFactory.Set ("Target", StringValue (m_target));
+
+  // flow queues are looked up by their index, which is lower than m_flows
+  m_flowsByIndex.assign (m_flows, 0);
+  m_tags.assign (m_flows, 0);
 }
 
 uint32_t
@@ -24,8 +24,8 @@
 
 #include "ns3/queue-disc.h"
 #include "ns3/object-factory.h"
-#include <list>
-#include <map>
+#include <deque>
+#include <vector>
 
 namespace ns3 {
 
@@ -174,11 +174,11 @@ private:
   bool m_enableSetAssociativeHash; //!< whether to enable set associative hash
   bool m_useL4s;             //!< True if L4S is used (ECT1 packets are marked at CE threshold)
 
-  std::list<Ptr<FqCoDelFlow> > m_newFlows;    //!< The list of new flows
-  std::list<Ptr<FqCoDelFlow> > m_oldFlows;    //!< The list of old flows
+  std::deque<Ptr<FqCoDelFlow> > m_newFlows;   //!< The list of new flows
+  std::deque<Ptr<FqCoDelFlow> > m_oldFlows;   //!< The list of old flows
 
-  std::map<uint32_t, uint32_t> m_flowsIndices;    //!< Map with the index of class for each flow
-  std::map<uint32_t, uint32_t> m_tags;            //!< Tags used by set associative hash
+  std::vector<Ptr<FqCoDelFlow> > m_flowsByIndex;  //!< Flow queue (null if not yet created) for each flow index
+  std::vector<uint32_t> m_tags;                   //!< Tags used by set associative hash
 
   ObjectFactory m_flowFactory;         //!< Factory to create a new flow
   ObjectFactory m_queueDiscFactory;    //!< Factory to create a new queue
@@ -0,0 +1,80 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include "ns3/assert.h"
+#include "error-rate-lookup-table.h"
+
+namespace ns3 {
+
+ErrorRateLookupTable::ErrorRateLookupTable ()
+  : m_minSnrDb (0),
+    m_resolutionDb (1)
+{
+}
+
+ErrorRateLookupTable::ErrorRateLookupTable (double minSnrDb, double maxSnrDb, double resolutionDb)
+  : m_minSnrDb (minSnrDb),
+    m_resolutionDb (resolutionDb)
+{
+  NS_ASSERT (resolutionDb > 0);
+  NS_ASSERT (maxSnrDb > minSnrDb);
+  m_logPe.resize (static_cast<uint32_t> (std::ceil ((maxSnrDb - minSnrDb) / resolutionDb)) + 1, 0);
+}
+
+uint32_t
+ErrorRateLookupTable::GetSize (void) const
+{
+  return m_logPe.size ();
+}
+
+double
+ErrorRateLookupTable::GetSnr (uint32_t index) const
+{
+  return std::pow (10.0, (m_minSnrDb + index * m_resolutionDb) / 10.0);
+}
+
+void
+ErrorRateLookupTable::Set (uint32_t index, double errorProbability)
+{
+  NS_ASSERT (index < m_logPe.size ());
+  //clamp to ]0, 1] so that the logarithm stays finite and interpolable
+  errorProbability = std::min (errorProbability, 1.0);
+  errorProbability = std::max (errorProbability, std::numeric_limits<double>::min ());
+  m_logPe[index] = std::log (errorProbability);
+}
+
+bool
+ErrorRateLookupTable::Lookup (double snr, double &errorProbability) const
+{
+  if (m_logPe.size () < 2 || snr <= 0)
+    {
+      return false;
+    }
+  double pos = (10.0 * std::log10 (snr) - m_minSnrDb) / m_resolutionDb;
+  if (pos < 0 || pos > m_logPe.size () - 1)
+    {
+      return false;
+    }
+  uint32_t index = std::min (static_cast<uint32_t> (pos), static_cast<uint32_t> (m_logPe.size () - 2));
+  double frac = pos - index;
+  errorProbability = std::exp (m_logPe[index] + frac * (m_logPe[index + 1] - m_logPe[index]));
+  return true;
+}
+
+} //namespace ns3
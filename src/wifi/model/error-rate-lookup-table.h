@@ -0,0 +1,83 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef ERROR_RATE_LOOKUP_TABLE_H
+#define ERROR_RATE_LOOKUP_TABLE_H
+
+#include <vector>
+#include <stdint.h>
+
+namespace ns3 {
+
+/**
+ * \ingroup wifi
+ * \brief A dense, uniformly sampled table of error probabilities indexed by SNR
+ *
+ * The table stores the natural logarithm of an error probability sampled
+ * every \c resolution dB between a minimum and a maximum SNR.  Lookups
+ * linearly interpolate the logarithm between the two closest samples, which
+ * follows the waterfall shape of BER curves much more closely than
+ * interpolating the probability itself.
+ *
+ * The table does not know how the samples are computed: the owning error
+ * rate model fills it once through Set () and then queries it with Lookup ().
+ */
+class ErrorRateLookupTable
+{
+public:
+  ErrorRateLookupTable ();
+  /**
+   * Create a table covering [minSnrDb, maxSnrDb] with the given resolution.
+   *
+   * \param minSnrDb the lowest SNR covered by the table (in dB)
+   * \param maxSnrDb the highest SNR covered by the table (in dB)
+   * \param resolutionDb the distance between two samples (in dB)
+   */
+  ErrorRateLookupTable (double minSnrDb, double maxSnrDb, double resolutionDb);
+
+  /**
+   * \return the number of samples in the table
+   */
+  uint32_t GetSize (void) const;
+  /**
+   * \param index the index of a sample
+   * \return the SNR (in linear scale) at which the sample has to be computed
+   */
+  double GetSnr (uint32_t index) const;
+  /**
+   * \param index the index of the sample
+   * \param errorProbability the error probability at GetSnr (index)
+   */
+  void Set (uint32_t index, double errorProbability);
+  /**
+   * Interpolate the error probability at the given SNR.
+   *
+   * \param snr the SNR (in linear scale)
+   * \param [out] errorProbability the interpolated error probability
+   * \return false if the SNR is outside the range covered by the table,
+   *         in which case errorProbability is left untouched
+   */
+  bool Lookup (double snr, double &errorProbability) const;
+
+private:
+  double m_minSnrDb;            //!< SNR of the first sample (in dB)
+  double m_resolutionDb;        //!< distance between two samples (in dB)
+  std::vector<double> m_logPe;  //!< natural logarithm of the sampled error probabilities
+};
+
+} //namespace ns3
+
+#endif /* ERROR_RATE_LOOKUP_TABLE_H */
@@ -22,6 +22,8 @@
 #include <cmath>
 #include <bitset>
 #include "ns3/log.h"
+#include "ns3/boolean.h"
+#include "ns3/double.h"
 #include "nist-error-rate-model.h"
 #include "wifi-tx-vector.h"
 
@@ -31,6 +33,10 @@ NS_LOG_COMPONENT_DEFINE ("NistErrorRateModel");
 
 NS_OBJECT_ENSURE_REGISTERED (NistErrorRateModel);
 
+/// SNR range (in dB) covered by the lookup tables; chunks outside use the closed-form expressions
+static const double NIST_TABLE_MIN_SNR_DB = -10.0;
+static const double NIST_TABLE_MAX_SNR_DB = 50.0;
+
 TypeId
 NistErrorRateModel::GetTypeId (void)
 {
@@ -38,11 +44,24 @@ NistErrorRateModel::GetTypeId (void)
     .SetParent<ErrorRateModel> ()
     .SetGroupName ("Wifi")
     .AddConstructor<NistErrorRateModel> ()
+    .AddAttribute ("UseLookupTable",
+                   "If true, interpolate the coded BER from precomputed SNR tables instead of "
+                   "evaluating the closed-form expressions for every chunk.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&NistErrorRateModel::m_useLookupTable),
+                   MakeBooleanChecker ())
+    .AddAttribute ("LookupTableResolution",
+                   "The SNR step (in dB) between two samples of the lookup tables.",
+                   DoubleValue (0.01),
+                   MakeDoubleAccessor (&NistErrorRateModel::m_tableResolution),
+                   MakeDoubleChecker<double> (0.0001, 1.0))
   ;
   return tid;
 }
 
 NistErrorRateModel::NistErrorRateModel ()
+  : m_useLookupTable (false),
+    m_tableResolution (0.01)
 {
 }
 
@@ -195,6 +214,54 @@ NistErrorRateModel::GetFecQamBer (uint16_t constellationSize, double snr, uint64
   return pms;
 }
 
+double
+NistErrorRateModel::GetCodedBer (uint16_t constellationSize, double snr, uint8_t bValue) const
+{
+  NS_LOG_FUNCTION (this << constellationSize << snr << +bValue);
+  double ber;
+  if (constellationSize == 2)
+    {
+      ber = GetBpskBer (snr);
+    }
+  else if (constellationSize == 4)
+    {
+      ber = GetQpskBer (snr);
+    }
+  else
+    {
+      ber = GetQamBer (constellationSize, snr);
+    }
+  if (ber == 0.0)
+    {
+      return 0.0;
+    }
+  return std::min (CalculatePe (ber, bValue), 1.0);
+}
+
+double
+NistErrorRateModel::GetTableChunkSuccessRate (uint16_t constellationSize, double snr, uint64_t nbits, uint8_t bValue) const
+{
+  NS_LOG_FUNCTION (this << constellationSize << snr << nbits << +bValue);
+  std::pair<uint16_t, uint8_t> key = std::make_pair (constellationSize, bValue);
+  LookupTables::iterator it = m_tables.find (key);
+  if (it == m_tables.end ())
+    {
+      NS_LOG_DEBUG ("Build lookup table for " << constellationSize << "-QAM with bValue=" << +bValue);
+      ErrorRateLookupTable table (NIST_TABLE_MIN_SNR_DB, NIST_TABLE_MAX_SNR_DB, m_tableResolution);
+      for (uint32_t i = 0; i < table.GetSize (); i++)
+        {
+          table.Set (i, GetCodedBer (constellationSize, table.GetSnr (i), bValue));
+        }
+      it = m_tables.insert (std::make_pair (key, table)).first;
+    }
+  double pe;
+  if (!it->second.Lookup (snr, pe))
+    {
+      pe = GetCodedBer (constellationSize, snr, bValue);
+    }
+  return std::pow (1 - pe, nbits);
+}
+
 uint8_t
 NistErrorRateModel::GetBValue (WifiCodeRate codeRate) const
 {
@@ -226,6 +293,10 @@ NistErrorRateModel::DoGetChunkSuccessRate (WifiMode mode, WifiTxVector txVector,
       || mode.GetModulationClass () == WIFI_MOD_CLASS_VHT
       || mode.GetModulationClass () == WIFI_MOD_CLASS_HE)
     {
+      if (m_useLookupTable)
+        {
+          return GetTableChunkSuccessRate (mode.GetConstellationSize (), snr, nbits, GetBValue (mode.GetCodeRate ()));
+        }
       if (mode.GetConstellationSize () == 2)
         {
           return GetFecBpskBer (snr, nbits, GetBValue (mode.GetCodeRate ()));
@@ -21,7 +21,9 @@
 #ifndef NIST_ERROR_RATE_MODEL_H
 #define NIST_ERROR_RATE_MODEL_H
 
+#include <map>
 #include "error-rate-model.h"
+#include "error-rate-lookup-table.h"
 #include "wifi-mode.h"
 
 namespace ns3 {
@@ -33,6 +35,12 @@ namespace ns3 {
  * the model description and validation can be found in
  * http://www.nsnam.org/~pei/80211ofdm.pdf.  For DSSS modulations (802.11b),
  * the model uses the DsssErrorRateModel.
+ *
+ * When the UseLookupTable attribute is set, the coded bit error rate of
+ * each (constellation size, coding rate) pair is sampled once over a dense
+ * SNR grid the first time that pair is needed, and subsequent chunks are
+ * evaluated by interpolating in that table instead of evaluating the erfc
+ * and polynomial bounds again.
  */
 class NistErrorRateModel : public ErrorRateModel
 {
@@ -57,6 +65,28 @@ private:
    * \return the bValue such that coding rate = bValue / (bValue + 1)
    */
   uint8_t GetBValue (WifiCodeRate codeRate) const;
+  /**
+   * Return the coded BER for a given constellation size at the given SNR.
+   *
+   * \param constellationSize the constellation size (M)
+   * \param snr SNR ratio (in linear scale)
+   * \param bValue the bValue such that coding rate = bValue / (bValue + 1)
+   *
+   * \return the coded BER, capped to 1
+   */
+  double GetCodedBer (uint16_t constellationSize, double snr, uint8_t bValue) const;
+  /**
+   * Return the chunk success rate using the lookup table of the given
+   * constellation size and coding rate, building that table if needed.
+   *
+   * \param constellationSize the constellation size (M)
+   * \param snr SNR ratio (in linear scale)
+   * \param nbits the number of bits in the chunk
+   * \param bValue the bValue such that coding rate = bValue / (bValue + 1)
+   *
+   * \return the chunk success rate
+   */
+  double GetTableChunkSuccessRate (uint16_t constellationSize, double snr, uint64_t nbits, uint8_t bValue) const;
   /**
    * Return the coded BER for the given p and b.
    *
@@ -121,6 +151,13 @@ private:
    * \return BER of QAM for a given constellation size at the given SNR after applying FEC
    */
   double GetFecQamBer (uint16_t constellationSize, double snr, uint64_t nbits, uint8_t bValue) const;
+
+  bool m_useLookupTable;      //!< flag whether the coded BER is interpolated from lookup tables
+  double m_tableResolution;   //!< SNR resolution of the lookup tables (in dB)
+
+  /// lookup tables indexed by constellation size and bValue
+  typedef std::map<std::pair<uint16_t, uint8_t>, ErrorRateLookupTable> LookupTables;
+  mutable LookupTables m_tables; //!< lookup tables, built on first use
 };
 
 } //namespace ns3
@@ -20,6 +20,8 @@
  */
 
 #include "ns3/log.h"
+#include "ns3/boolean.h"
+#include "ns3/double.h"
 #include "yans-error-rate-model.h"
 #include "wifi-utils.h"
 #include "wifi-phy.h"
@@ -30,6 +32,10 @@ NS_LOG_COMPONENT_DEFINE ("YansErrorRateModel");
 
 NS_OBJECT_ENSURE_REGISTERED (YansErrorRateModel);
 
+/// Eb/No range (in dB) covered by the lookup tables; chunks outside use the closed-form expressions
+static const double YANS_TABLE_MIN_EBNO_DB = -20.0;
+static const double YANS_TABLE_MAX_EBNO_DB = 50.0;
+
 TypeId
 YansErrorRateModel::GetTypeId (void)
 {
@@ -37,11 +43,24 @@ YansErrorRateModel::GetTypeId (void)
     .SetParent<ErrorRateModel> ()
     .SetGroupName ("Wifi")
     .AddConstructor<YansErrorRateModel> ()
+    .AddAttribute ("UseLookupTable",
+                   "If true, interpolate the coded BER from precomputed Eb/No tables instead of "
+                   "evaluating the closed-form expressions for every chunk.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&YansErrorRateModel::m_useLookupTable),
+                   MakeBooleanChecker ())
+    .AddAttribute ("LookupTableResolution",
+                   "The Eb/No step (in dB) between two samples of the lookup tables.",
+                   DoubleValue (0.01),
+                   MakeDoubleAccessor (&YansErrorRateModel::m_tableResolution),
+                   MakeDoubleChecker<double> (0.0001, 1.0))
   ;
   return tid;
 }
 
 YansErrorRateModel::YansErrorRateModel ()
+  : m_useLookupTable (false),
+    m_tableResolution (0.01)
 {
 }
 
@@ -142,6 +161,10 @@ YansErrorRateModel::GetFecBpskBer (double snr, uint64_t nbits,
                                    uint32_t dFree, uint32_t adFree) const
 {
   NS_LOG_FUNCTION (this << snr << nbits << signalSpread << phyRate << dFree << adFree);
+  if (m_useLookupTable)
+    {
+      return GetTableChunkSuccessRate (snr * signalSpread / phyRate, nbits, 2, dFree, adFree, 0);
+    }
   double ber = GetBpskBer (snr, signalSpread, phyRate);
   if (ber == 0.0)
     {
@@ -162,6 +185,10 @@ YansErrorRateModel::GetFecQamBer (double snr, uint64_t nbits,
                                   uint32_t adFree, uint32_t adFreePlusOne) const
 {
   NS_LOG_FUNCTION (this << snr << nbits << signalSpread << phyRate << m << dFree << adFree << adFreePlusOne);
+  if (m_useLookupTable)
+    {
+      return GetTableChunkSuccessRate (snr * signalSpread / phyRate, nbits, m, dFree, adFree, adFreePlusOne);
+    }
   double ber = GetQamBer (snr, m, signalSpread, phyRate);
   if (ber == 0.0)
     {
@@ -178,6 +205,50 @@ YansErrorRateModel::GetFecQamBer (double snr, uint64_t nbits,
   return pms;
 }
 
+double
+YansErrorRateModel::GetCodedBer (double ebno, uint32_t m, uint32_t dFree,
+                                 uint32_t adFree, uint32_t adFreePlusOne) const
+{
+  NS_LOG_FUNCTION (this << ebno << m << dFree << adFree << adFreePlusOne);
+  //Eb/No is obtained from the SNR with a unit signal spread and PHY rate
+  double ber = (m == 2) ? GetBpskBer (ebno, 1, 1) : GetQamBer (ebno, m, 1, 1);
+  if (ber == 0.0)
+    {
+      return 0.0;
+    }
+  double pmu = adFree * CalculatePd (ber, dFree);
+  if (adFreePlusOne > 0)
+    {
+      pmu += adFreePlusOne * CalculatePd (ber, dFree + 1);
+    }
+  return std::min (pmu, 1.0);
+}
+
+double
+YansErrorRateModel::GetTableChunkSuccessRate (double ebno, uint64_t nbits, uint32_t m, uint32_t dFree,
+                                              uint32_t adFree, uint32_t adFreePlusOne) const
+{
+  NS_LOG_FUNCTION (this << ebno << nbits << m << dFree << adFree << adFreePlusOne);
+  std::tuple<uint32_t, uint32_t, uint32_t, uint32_t> key = std::make_tuple (m, dFree, adFree, adFreePlusOne);
+  LookupTables::iterator it = m_tables.find (key);
+  if (it == m_tables.end ())
+    {
+      NS_LOG_DEBUG ("Build lookup table for m=" << m << " dFree=" << dFree);
+      ErrorRateLookupTable table (YANS_TABLE_MIN_EBNO_DB, YANS_TABLE_MAX_EBNO_DB, m_tableResolution);
+      for (uint32_t i = 0; i < table.GetSize (); i++)
+        {
+          table.Set (i, GetCodedBer (table.GetSnr (i), m, dFree, adFree, adFreePlusOne));
+        }
+      it = m_tables.insert (std::make_pair (key, table)).first;
+    }
+  double pmu;
+  if (!it->second.Lookup (ebno, pmu))
+    {
+      pmu = GetCodedBer (ebno, m, dFree, adFree, adFreePlusOne);
+    }
+  return std::pow (1 - pmu, nbits);
+}
+
 double
 YansErrorRateModel::DoGetChunkSuccessRate (WifiMode mode, WifiTxVector txVector, double snr, uint64_t nbits) const
 {
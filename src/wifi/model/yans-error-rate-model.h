@@ -21,7 +21,10 @@
 #ifndef YANS_ERROR_RATE_MODEL_H
 #define YANS_ERROR_RATE_MODEL_H
 
+#include <map>
+#include <tuple>
 #include "error-rate-model.h"
+#include "error-rate-lookup-table.h"
 
 namespace ns3 {
 
@@ -49,6 +52,10 @@ namespace ns3 {
  *      57(2):440-449, February 2009.
  *    - More detailed description and validation can be found in
  *      http://www.nsnam.org/~pei/80211b.pdf
+ *
+ * When the UseLookupTable attribute is set, the coded bit error rate of each
+ * modulation and code is sampled once over a dense Eb/No grid the first time
+ * it is needed, and chunks are then evaluated by interpolating in that table.
  */
 class YansErrorRateModel : public ErrorRateModel
 {
@@ -155,6 +162,42 @@ private:
                        uint64_t phyRate,
                        uint32_t m, uint32_t dfree,
                        uint32_t adFree, uint32_t adFreePlusOne) const;
+  /**
+   * Return the coded BER (union bound on the first error event
+   * probabilities) for the given parameters.
+   *
+   * \param ebno Eb/No ratio (not dB)
+   * \param m the constellation size, 2 meaning BPSK
+   * \param dFree
+   * \param adFree
+   * \param adFreePlusOne
+   *
+   * \return the coded BER, capped to 1
+   */
+  double GetCodedBer (double ebno, uint32_t m, uint32_t dFree,
+                      uint32_t adFree, uint32_t adFreePlusOne) const;
+  /**
+   * Return the chunk success rate using the lookup table matching the given
+   * parameters, building that table if needed.
+   *
+   * \param ebno Eb/No ratio (not dB)
+   * \param nbits
+   * \param m the constellation size, 2 meaning BPSK
+   * \param dFree
+   * \param adFree
+   * \param adFreePlusOne
+   *
+   * \return the chunk success rate
+   */
+  double GetTableChunkSuccessRate (double ebno, uint64_t nbits, uint32_t m, uint32_t dFree,
+                                   uint32_t adFree, uint32_t adFreePlusOne) const;
+
+  bool m_useLookupTable;      //!< flag whether the coded BER is interpolated from lookup tables
+  double m_tableResolution;   //!< Eb/No resolution of the lookup tables (in dB)
+
+  /// lookup tables indexed by constellation size, dFree, adFree and adFreePlusOne
+  typedef std::map<std::tuple<uint32_t, uint32_t, uint32_t, uint32_t>, ErrorRateLookupTable> LookupTables;
+  mutable LookupTables m_tables; //!< lookup tables, built on first use
 };
 
 } //namespace ns3
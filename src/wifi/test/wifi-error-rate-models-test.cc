@@ -21,6 +21,7 @@
 
 #include "ns3/log.h"
 #include "ns3/test.h"
+#include "ns3/boolean.h"
 #include "ns3/nist-error-rate-model.h"
 #include "ns3/yans-error-rate-model.h"
 #include "ns3/dsss-error-rate-model.h"
@@ -1051,6 +1052,75 @@ TableBasedErrorRateTestCase::DoRun (void)
     }
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Wifi Error Rate Models Lookup Table Test Case
+ *
+ * Check that the table-driven modes of NistErrorRateModel and
+ * YansErrorRateModel match the closed-form expressions.
+ */
+class WifiErrorRateModelsTestCaseLookupTable : public TestCase
+{
+public:
+  WifiErrorRateModelsTestCaseLookupTable ();
+  virtual ~WifiErrorRateModelsTestCaseLookupTable ();
+
+private:
+  virtual void DoRun (void);
+  /**
+   * Compare the chunk success rates returned by two error rate models
+   * for all HE MCSs over a range of SNRs.
+   *
+   * \param reference the error rate model using the closed-form expressions
+   * \param table the error rate model using the lookup tables
+   * \param name the name of the model, for reporting
+   */
+  void CompareModels (Ptr<ErrorRateModel> reference, Ptr<ErrorRateModel> table, std::string name);
+};
+
+WifiErrorRateModelsTestCaseLookupTable::WifiErrorRateModelsTestCaseLookupTable ()
+  : TestCase ("WifiErrorRateModel test case lookup tables")
+{
+}
+
+WifiErrorRateModelsTestCaseLookupTable::~WifiErrorRateModelsTestCaseLookupTable ()
+{
+}
+
+void
+WifiErrorRateModelsTestCaseLookupTable::CompareModels (Ptr<ErrorRateModel> reference, Ptr<ErrorRateModel> table, std::string name)
+{
+  uint32_t frameSize = 1500;
+  for (uint8_t mcs = 0; mcs <= 11; mcs++)
+    {
+      WifiMode mode = WifiPhy::GetHeMcs (mcs);
+      WifiTxVector txVector;
+      txVector.SetMode (mode);
+      for (double snr = -5.0; snr <= 45.0; snr += 0.37)
+        {
+          double expected = reference->GetChunkSuccessRate (mode, txVector, std::pow (10.0, snr / 10.0), frameSize * 8);
+          double ps = table->GetChunkSuccessRate (mode, txVector, std::pow (10.0, snr / 10.0), frameSize * 8);
+          NS_TEST_ASSERT_MSG_EQ_TOL (ps, expected, 1e-3, name << " HE MCS " << +mcs << " at " << snr << " dB");
+        }
+    }
+}
+
+void
+WifiErrorRateModelsTestCaseLookupTable::DoRun (void)
+{
+  Ptr<NistErrorRateModel> nist = CreateObject<NistErrorRateModel> ();
+  Ptr<NistErrorRateModel> nistTable = CreateObject<NistErrorRateModel> ();
+  nistTable->SetAttribute ("UseLookupTable", BooleanValue (true));
+  CompareModels (nist, nistTable, "NIST");
+
+  Ptr<YansErrorRateModel> yans = CreateObject<YansErrorRateModel> ();
+  Ptr<YansErrorRateModel> yansTable = CreateObject<YansErrorRateModel> ();
+  yansTable->SetAttribute ("UseLookupTable", BooleanValue (true));
+  CompareModels (yans, yansTable, "YANS");
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -1069,6 +1139,7 @@ WifiErrorRateModelsTestSuite::WifiErrorRateModelsTestSuite ()
   AddTestCase (new WifiErrorRateModelsTestCaseDsss, TestCase::QUICK);
   AddTestCase (new WifiErrorRateModelsTestCaseNist, TestCase::QUICK);
   AddTestCase (new WifiErrorRateModelsTestCaseMimo, TestCase::QUICK);
+  AddTestCase (new WifiErrorRateModelsTestCaseLookupTable, TestCase::QUICK);
   AddTestCase (new TableBasedErrorRateTestCase ("DefaultTableBasedHtMcs0-1458bytes", WifiPhy::GetHtMcs0 (), 1458), TestCase::QUICK);
   AddTestCase (new TableBasedErrorRateTestCase ("DefaultTableBasedHtMcs0-32bytes", WifiPhy::GetHtMcs0 (), 32), TestCase::QUICK);
   AddTestCase (new TableBasedErrorRateTestCase ("DefaultTableBasedHtMcs0-1000bytes", WifiPhy::GetHtMcs0 (), 1000), TestCase::QUICK);